@@ -0,0 +1,46 @@
+/**
+ * @file       adc_sample.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Sample record stored in the ADC circular buffer.
+ *
+ * @note       One record per TIM2 tick. The ring is initialized with
+ *             cb_init_elem(..., sizeof(adc_sample_t)) so records are always
+ *             written and read whole. Ring<T, N> in ring.hpp uses the same
+ *             record layout for host tools.
+ * @example    main.c
+ *             Main application building UART frames from sample records.
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_ADC_SAMPLE_H_
+#define INC_ADC_SAMPLE_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define ADC_SAMPLE_RING_SIZE 1024 /*!< Number of records in ADC ring (power of two) */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief One acquired sample: raw ADC value and its bandpass output.
+ */
+typedef struct
+{
+    uint16_t raw;      /**< Raw 12-bit ADC value */
+    int16_t filtered;  /**< Bandpass filtered value */
+} adc_sample_t;
+
+#ifndef __cplusplus
+_Static_assert(sizeof(adc_sample_t) == 4, "adc_sample_t must be 4 bytes");
+#else
+static_assert(sizeof(adc_sample_t) == 4, "adc_sample_t must be 4 bytes");
+#endif
+
+#endif /* INC_ADC_SAMPLE_H_ */
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,211 @@
+/**
+ * @file       bandpass.hpp
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Header-only C++17 Bandpass Filter specialized at compile time
+ *             for a sample rate, band and number of channels.
+ *
+ * @note       Same structure as filter.c: a moving-average low-pass followed
+ *             by subtracting a scaled moving average, both as running sums.
+ *             Every constant is derived with constexpr from the template
+ *             arguments:
+ *               low-pass window  L = round(Fs / HighCut)  (first null at HighCut)
+ *               low-pass scale   round(15/8 * 1024 / L) >> 10 (DC gain 15/8)
+ *               high-pass window H = next power of two >= Fs / (2 pi LowCut)
+ *               high-pass shift  log2(H) + 1
+ *             For Bandpass<200, 500, 40000> this gives L = 5, scale 384,
+ *             H = 64, shift 7, the constants hard-coded in filter.c, and the
+ *             output is bit-exact with BandpassFilter_Apply. All members are
+ *             constexpr so the filter can also run inside static_assert.
+ * @example    bandpass.hpp
+ *             Bandpass<200, 500, 40000> bp;   // 200 Hz, 0.5-40 Hz
+ *             int32_t y = bp.apply(adc);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_BANDPASS_HPP_
+#define INC_BANDPASS_HPP_
+
+/* Includes ----------------------------------------------------------- */
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/* Public class ------------------------------------------------------- */
+namespace bandpass_detail
+{
+/**
+ * @brief  Integer division rounded to nearest.
+ */
+constexpr uint32_t div_round(uint64_t num, uint64_t den) { return static_cast<uint32_t>((num + den / 2) / den); }
+
+/**
+ * @brief  Smallest power of two not below x.
+ */
+constexpr uint32_t pow2_ceil(uint32_t x)
+{
+    uint32_t p = 1;
+    while (p < x)
+        p <<= 1;
+    return p;
+}
+
+/**
+ * @brief  log2 of a power of two.
+ */
+constexpr uint32_t log2_pow2(uint32_t x)
+{
+    uint32_t n = 0;
+    while (x > 1)
+    {
+        x >>= 1;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief  Fs / (2 pi f) for f in mHz, rounded up, without floating point.
+ *         2 pi is approximated by 710 / 113.
+ */
+constexpr uint32_t samples_per_radian(uint32_t fs, uint32_t f_mhz)
+{
+    uint64_t num = static_cast<uint64_t>(fs) * 1000u * 113u;
+    uint64_t den = static_cast<uint64_t>(f_mhz) * 710u;
+    return static_cast<uint32_t>((num + den - 1) / den);
+}
+} // namespace bandpass_detail
+
+/**
+ * @brief Bandpass Filter for Lanes independent channels.
+ *
+ * @tparam Fs            Sample rate in Hz.
+ * @tparam LowCutMilliHz  High-pass corner in mHz.
+ * @tparam HighCutMilliHz Low-pass null in mHz.
+ * @tparam Lanes         Number of channels filtered per step.
+ */
+template <uint32_t Fs, uint32_t LowCutMilliHz, uint32_t HighCutMilliHz, uint32_t Lanes = 1>
+class Bandpass
+{
+    static_assert(Fs > 0, "Fs must be positive");
+    static_assert(LowCutMilliHz > 0 && LowCutMilliHz < HighCutMilliHz, "need 0 < LowCut < HighCut");
+    static_assert(HighCutMilliHz * 2u <= Fs * 1000u, "HighCut must not exceed Fs / 2");
+    static_assert(Lanes > 0, "need at least one lane");
+
+public:
+    static constexpr uint32_t kLowpassWindow = bandpass_detail::div_round(Fs * 1000ull, HighCutMilliHz);
+    static constexpr uint32_t kLowpassShift = 10;
+    static constexpr int32_t kLowpassScale =
+        static_cast<int32_t>(bandpass_detail::div_round(15ull << kLowpassShift, 8ull * kLowpassWindow));
+    static constexpr uint32_t kHighpassWindow =
+        bandpass_detail::pow2_ceil(bandpass_detail::samples_per_radian(Fs, LowCutMilliHz));
+    static constexpr uint32_t kHighpassShift = bandpass_detail::log2_pow2(kHighpassWindow) + 1;
+    static constexpr uint32_t kLanes = Lanes;
+
+    static_assert(kLowpassWindow >= 2, "HighCut too close to Fs / 2 for a moving average");
+    static_assert(kHighpassWindow <= 65536, "LowCut too low for the high-pass window");
+
+    /**
+     * @brief  Clear the filter state.
+     */
+    constexpr void reset()
+    {
+        *this = Bandpass();
+    }
+
+    /**
+     * @brief  Filter one step of all lanes.
+     *
+     * @param[in]   in   Lanes input samples.
+     * @param[out]  out  Lanes filtered samples, may alias in.
+     */
+    constexpr void step(const int32_t *in, int32_t *out)
+    {
+        step_lanes(in, out, std::make_index_sequence<Lanes>{});
+        advance();
+    }
+
+    /**
+     * @brief  Filter one sample, single-lane filters only.
+     *
+     * @return Filtered sample.
+     */
+    template <uint32_t L = Lanes, typename = std::enable_if_t<L == 1>>
+    constexpr int32_t apply(int32_t x)
+    {
+        int32_t y = lane<0>(x);
+        advance();
+        return y;
+    }
+
+    /**
+     * @brief  Filter n steps of lane-interleaved data, in[t * Lanes + lane].
+     */
+    constexpr void apply_block(const int32_t *in, int32_t *out, size_t n)
+    {
+        for (size_t t = 0; t < n; t++)
+            step(in + t * Lanes, out + t * Lanes);
+    }
+
+private:
+    /**
+     * @brief  One lane, the arithmetic of BandpassFilter_Apply.
+     */
+    template <size_t I>
+    constexpr int32_t lane(int32_t x)
+    {
+        lowpass_sum_[I] += x - lowpass_buffer_[lowpass_index_][I];
+        lowpass_buffer_[lowpass_index_][I] = x;
+        int32_t lowpass = (lowpass_sum_[I] * kLowpassScale) >> kLowpassShift;
+
+        highpass_sum_[I] += lowpass - highpass_buffer_[highpass_index_][I];
+        highpass_buffer_[highpass_index_][I] = lowpass;
+        int32_t highpass = lowpass - (highpass_sum_[I] >> kHighpassShift);
+
+        if (highpass > 32767) highpass = 32767;
+        if (highpass < -32768) highpass = -32768;
+        return highpass;
+    }
+
+    /**
+     * @brief  All lanes, expanded at compile time.
+     */
+    template <size_t... I>
+    constexpr void step_lanes(const int32_t *in, int32_t *out, std::index_sequence<I...>)
+    {
+        // Read every lane before writing any, so out may alias in
+        int32_t x[Lanes] = {in[I]...};
+        ((out[I] = lane<I>(x[I])), ...);
+    }
+
+    /**
+     * @brief  Move both windows one sample forward.
+     */
+    constexpr void advance()
+    {
+        if constexpr ((kLowpassWindow & (kLowpassWindow - 1)) == 0)
+        {
+            lowpass_index_ = (lowpass_index_ + 1) & (kLowpassWindow - 1);
+        }
+        else
+        {
+            if (++lowpass_index_ == kLowpassWindow)
+                lowpass_index_ = 0;
+        }
+        highpass_index_ = (highpass_index_ + 1) & (kHighpassWindow - 1);
+    }
+
+    int32_t lowpass_buffer_[kLowpassWindow][Lanes] = {};   /**< Low-pass window */
+    int32_t highpass_buffer_[kHighpassWindow][Lanes] = {}; /**< High-pass window */
+    int32_t lowpass_sum_[Lanes] = {};                      /**< Running sums */
+    int32_t highpass_sum_[Lanes] = {};                     /**< Running sums */
+    uint32_t lowpass_index_ = 0;                           /**< Oldest low-pass entry */
+    uint32_t highpass_index_ = 0;                          /**< Oldest high-pass entry */
+};
+
+#endif /* INC_BANDPASS_HPP_ */
+/* End of file -------------------------------------------------------- */
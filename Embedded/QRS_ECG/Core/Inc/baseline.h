@@ -0,0 +1,99 @@
+/**
+ * @file       baseline.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Header file for multirate baseline wander removal on STM32.
+ *
+ * @note       The input is averaged over blocks of BASELINE_DECIMATION
+ *             samples (25 Hz at 200 Hz), a running median over
+ *             BASELINE_WINDOW block averages (3 s) estimates the baseline,
+ *             and the estimate is interpolated linearly back to the input
+ *             rate and subtracted from the input delayed by
+ *             BASELINE_DELAY samples, the group delay of the estimator.
+ *             The median runs once per block, so a 3 s window costs about
+ *             BASELINE_WINDOW / BASELINE_DECIMATION compares per sample.
+ * @example    baseline.h
+ *             BaselineFilter_Init(&baseline);
+ *             int32_t y = BaselineFilter_Apply(&baseline, adc);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_BASELINE_H_
+#define INC_BASELINE_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define BASELINE_DECIMATION 8    /* Must stay 8, interpolation divides by 64 */
+#define BASELINE_WINDOW 75       /* Block averages in the median, odd */
+#define BASELINE_DELAY_SIZE 512  /* Power of two above BASELINE_DELAY */
+#define BASELINE_DELAY (BASELINE_DECIMATION * (BASELINE_WINDOW + 1) / 2 + BASELINE_DECIMATION / 2)
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Structure to store data for the baseline filter.
+ */
+typedef struct {
+    int32_t delay[BASELINE_DELAY_SIZE];   /*!< Input delayed to match the estimate */
+    int32_t window[BASELINE_WINDOW];      /*!< Block sums, oldest at window_index */
+    int32_t sorted[BASELINE_WINDOW];      /*!< Same block sums, ascending */
+    int32_t block_sum;                    /*!< Sum of the current block so far */
+    int32_t median_prev;                  /*!< Median block sum before the last block */
+    int32_t median;                       /*!< Median block sum after the last block */
+    uint16_t delay_index;                 /*!< Next delay slot to write */
+    uint8_t window_index;                 /*!< Oldest block sum */
+    uint8_t phase;                        /*!< Samples in the current block */
+    uint8_t primed;                       /*!< State seeded from the first sample */
+} BaselineFilter;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize the baseline filter.
+ *
+ * @param[inout]  filter  Pointer to the BaselineFilter structure.
+ *
+ * @attention  Must be called before using the filter. The first sample
+ *             seeds the whole state, so there is no start-up step.
+ *
+ * @return
+ *  - None
+ */
+void BaselineFilter_Init(BaselineFilter* filter);
+
+/**
+ * @brief  Remove the baseline from a new sample.
+ *
+ * @param[inout]  filter      Pointer to the BaselineFilter structure.
+ * @param[in]     new_sample  New sample, int16 range.
+ *
+ * @attention  The output is the input of BASELINE_DELAY samples ago
+ *             (1.54 s at 200 Hz) minus the baseline at that time.
+ *
+ * @return
+ *  - Baseline-free value (int32_t)
+ */
+int32_t BaselineFilter_Apply(BaselineFilter* filter, int32_t new_sample);
+
+/**
+ * @brief  Remove the baseline from a block of samples.
+ *
+ * @param[inout]  filter  Pointer to the BaselineFilter structure.
+ * @param[in]     in      Input samples.
+ * @param[out]    out     Output samples, may alias in.
+ * @param[in]     n       Number of samples.
+ *
+ * @attention  Same output as calling BaselineFilter_Apply on every sample.
+ *
+ * @return
+ *  - None
+ */
+void BaselineFilter_ApplyBlock(BaselineFilter* filter, const int32_t* in, int32_t* out, size_t n);
+
+#endif /* INC_BASELINE_H_ */
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,158 @@
+/**
+ * @file       bcast_ring.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Single writer, multi reader broadcast ring for STM32.
+ *             Every attached reader sees the whole stream through its own
+ *             cursor, the data is stored once.
+ *
+ * @note       Same threading model as cbuffer: one writer (e.g. IRQ), readers
+ *             in lower priority contexts on a single core. Count must be a
+ *             power of two, indices are free-running element counters.
+ *             CB_POLICY_DROP_NEW: the writer checks the slowest attached
+ *             cursor and never overruns a reader. CB_POLICY_OVERWRITE: the
+ *             writer never blocks, a reader that falls more than count
+ *             elements behind skips ahead and records the loss.
+ * @example    bcast_ring.h
+ *             uint32_t uart = bcast_attach(&ring);
+ *             bcast_read(&ring, uart, samples, 64);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_BCAST_RING_H_
+#define INC_BCAST_RING_H_
+
+/* Includes ----------------------------------------------------------- */
+#include "cbuffer.h"
+
+/* Public defines ----------------------------------------------------- */
+#define BCAST_MAX_READERS (4)          /*!< Max number of attached readers */
+#define BCAST_ERROR       (0xFFFFFFFF) /*!< Error return value */
+#define BCAST_SUCCESS     (0x00000000) /*!< Success return value */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Per-reader state.
+ */
+typedef struct
+{
+    volatile uint32_t cursor;   /**< Free-running read index (elements) */
+    volatile uint32_t lost;     /**< Elements skipped after overruns */
+    volatile uint32_t overruns; /**< Number of overruns detected */
+    volatile bool attached;     /**< Slot in use */
+} bcast_reader_t;
+
+/**
+ * @brief Broadcast ring structure definition.
+ */
+typedef struct
+{
+    uint8_t *data;                              /**< Pointer to storage */
+    uint32_t count;                             /**< Number of elements */
+    uint32_t mask;                              /**< count - 1 */
+    uint32_t elem_size;                         /**< Size of one element */
+    cb_policy_t policy;                         /**< What to do when the slowest reader is full */
+    volatile uint32_t head;                     /**< Free-running write index (elements) */
+    volatile uint32_t refused;                  /**< Elements not written (drop-new) */
+    bcast_reader_t readers[BCAST_MAX_READERS];  /**< Reader slots */
+} bcast_ring_t;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize broadcast ring.
+ *
+ * @param[inout]  ring       Pointer to a bcast_ring_t structure.
+ * @param[in]     buf        Pointer to storage of count * elem_size bytes.
+ * @param[in]     count      Number of elements, power of two.
+ * @param[in]     elem_size  Size of one element in bytes.
+ * @param[in]     policy     What to do when the slowest reader is full.
+ *
+ * @attention  Must be called before using the ring.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t bcast_init(bcast_ring_t *ring, void *buf, uint32_t count, uint32_t elem_size, cb_policy_t policy);
+
+/**
+ * @brief  Attach a new reader.
+ *
+ * @param[inout]  ring  Pointer to a bcast_ring_t structure.
+ *
+ * @attention  The reader starts at the current write position and only sees
+ *             data written after attaching.
+ *
+ * @return
+ *  - Reader id: Success
+ *  - (-1): Error, no free slot
+ */
+uint32_t bcast_attach(bcast_ring_t *ring);
+
+/**
+ * @brief  Detach a reader, it no longer holds back the writer.
+ *
+ * @param[inout]  ring  Pointer to a bcast_ring_t structure.
+ * @param[in]     id    Reader id from bcast_attach.
+ *
+ * @attention  None
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t bcast_detach(bcast_ring_t *ring, uint32_t id);
+
+/**
+ * @brief  Write elements to broadcast ring. Writer side only.
+ *
+ * @param[inout]  ring   Pointer to a bcast_ring_t structure.
+ * @param[in]     items  Pointer to elements.
+ * @param[in]     n      Number of elements to write.
+ *
+ * @attention  With CB_POLICY_DROP_NEW writes only what the slowest attached
+ *             reader has room for.
+ *
+ * @return
+ *  - Number of elements written: Success
+ *  - (-1): Error
+ */
+uint32_t bcast_write(bcast_ring_t *ring, const void *items, uint32_t n);
+
+/**
+ * @brief  Read elements for one reader.
+ *
+ * @param[inout]  ring   Pointer to a bcast_ring_t structure.
+ * @param[in]     id     Reader id from bcast_attach.
+ * @param[out]    items  Pointer to destination.
+ * @param[in]     n      Number of elements to read.
+ *
+ * @attention  Each reader must be served from one context only.
+ *
+ * @return
+ *  - Number of elements read: Success
+ *  - (-1): Error
+ */
+uint32_t bcast_read(bcast_ring_t *ring, uint32_t id, void *items, uint32_t n);
+
+/**
+ * @brief  Return how many elements a reader is behind the writer.
+ *
+ * @param[in]  ring  Pointer to a bcast_ring_t structure.
+ * @param[in]  id    Reader id from bcast_attach.
+ *
+ * @attention  Can exceed count with CB_POLICY_OVERWRITE, meaning the reader
+ *             has been overrun and will skip data on its next read.
+ *
+ * @return
+ *  - Lag in elements: Success
+ *  - (-1): Error
+ */
+uint32_t bcast_lag(bcast_ring_t *ring, uint32_t id);
+
+#endif /* INC_BCAST_RING_H_ */
+/* End of file -------------------------------------------------------- */
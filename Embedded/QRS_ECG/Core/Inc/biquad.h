@@ -0,0 +1,168 @@
+/**
+ * @file       biquad.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Fixed-point direct form I biquad cascade for STM32.
+ *
+ * @note       Each stage computes
+ *             y = (b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2) >> (N - 1 - shift)
+ *             with a 64-bit accumulator and rounding, N = 32 (Q31) or 16
+ *             (Q15). Coefficients are {b0, b1, b2, -a1, -a2} per stage in
+ *             Q(N-1-shift), as emitted by evaluate/src/gen_biquad.py into
+ *             biquad_coeffs.h. Use Q31 for cutoffs near DC: with 12-bit ADC
+ *             samples shifted into the top bits, the rounding noise of the
+ *             0.5 Hz stage stays well below one ADC step.
+ * @example    biquad.h
+ *             BiquadQ31_Init(&bp, biquad_bp_200hz_q31, bp_state,
+ *                            BIQUAD_BP_STAGES, BIQUAD_BP_200HZ_Q31_SHIFT);
+ *             int32_t y = BiquadQ31_Apply(&bp, (int32_t)adc << 19);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_BIQUAD_H_
+#define INC_BIQUAD_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define BIQUAD_COEFFS_PER_STAGE 5 /* b0, b1, b2, -a1, -a2 */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Per-stage delay line, Q31.
+ */
+typedef struct {
+    int32_t x1; /*!< x[n-1] */
+    int32_t x2; /*!< x[n-2] */
+    int32_t y1; /*!< y[n-1] */
+    int32_t y2; /*!< y[n-2] */
+} BiquadStateQ31;
+
+/**
+ * @brief Per-stage delay line, Q15.
+ */
+typedef struct {
+    int16_t x1; /*!< x[n-1] */
+    int16_t x2; /*!< x[n-2] */
+    int16_t y1; /*!< y[n-1] */
+    int16_t y2; /*!< y[n-2] */
+    int16_t err; /*!< Fraction dropped from the last output */
+} BiquadStateQ15;
+
+/**
+ * @brief Q31 biquad cascade.
+ */
+typedef struct {
+    const int32_t* coeffs;  /*!< num_stages * 5 coefficients */
+    BiquadStateQ31* state;  /*!< num_stages delay lines */
+    uint8_t num_stages;     /*!< Number of stages */
+    uint8_t shift;          /*!< Coefficient headroom bits */
+} BiquadQ31;
+
+/**
+ * @brief Q15 biquad cascade.
+ */
+typedef struct {
+    const int16_t* coeffs;  /*!< num_stages * 5 coefficients */
+    BiquadStateQ15* state;  /*!< num_stages delay lines */
+    uint8_t num_stages;     /*!< Number of stages */
+    uint8_t shift;          /*!< Coefficient headroom bits */
+} BiquadQ15;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize a Q31 biquad cascade and clear its state.
+ *
+ * @param[inout]  biquad      Pointer to the BiquadQ31 structure.
+ * @param[in]     coeffs      Coefficients, kept by pointer.
+ * @param[in]     state       Storage for num_stages delay lines.
+ * @param[in]     num_stages  Number of stages.
+ * @param[in]     shift       Coefficient headroom bits (0..30).
+ *
+ * @attention  Must be called before using the cascade.
+ *
+ * @return
+ *  - None
+ */
+void BiquadQ31_Init(BiquadQ31* biquad, const int32_t* coeffs, BiquadStateQ31* state, uint8_t num_stages, uint8_t shift);
+
+/**
+ * @brief  Filter one Q31 sample through the cascade.
+ *
+ * @param[inout]  biquad  Pointer to the BiquadQ31 structure.
+ * @param[in]     x       Input sample.
+ *
+ * @attention  Each stage output saturates to the int32 range.
+ *
+ * @return
+ *  - Filtered sample
+ */
+int32_t BiquadQ31_Apply(BiquadQ31* biquad, int32_t x);
+
+/**
+ * @brief  Filter a block of Q31 samples through the cascade.
+ *
+ * @param[inout]  biquad  Pointer to the BiquadQ31 structure.
+ * @param[in]     in      Input samples.
+ * @param[out]    out     Filtered samples, may alias in.
+ * @param[in]     n       Number of samples.
+ *
+ * @attention  Same output as calling BiquadQ31_Apply on every sample.
+ *
+ * @return
+ *  - None
+ */
+void BiquadQ31_ApplyBlock(BiquadQ31* biquad, const int32_t* in, int32_t* out, size_t n);
+
+/**
+ * @brief  Initialize a Q15 biquad cascade and clear its state.
+ *
+ * @param[inout]  biquad      Pointer to the BiquadQ15 structure.
+ * @param[in]     coeffs      Coefficients, kept by pointer.
+ * @param[in]     state       Storage for num_stages delay lines.
+ * @param[in]     num_stages  Number of stages.
+ * @param[in]     shift       Coefficient headroom bits (0..14).
+ *
+ * @attention  Must be called before using the cascade.
+ *
+ * @return
+ *  - None
+ */
+void BiquadQ15_Init(BiquadQ15* biquad, const int16_t* coeffs, BiquadStateQ15* state, uint8_t num_stages, uint8_t shift);
+
+/**
+ * @brief  Filter one Q15 sample through the cascade.
+ *
+ * @param[inout]  biquad  Pointer to the BiquadQ15 structure.
+ * @param[in]     x       Input sample.
+ *
+ * @attention  Each stage output saturates to the int16 range.
+ *
+ * @return
+ *  - Filtered sample
+ */
+int16_t BiquadQ15_Apply(BiquadQ15* biquad, int16_t x);
+
+/**
+ * @brief  Filter a block of Q15 samples through the cascade.
+ *
+ * @param[inout]  biquad  Pointer to the BiquadQ15 structure.
+ * @param[in]     in      Input samples.
+ * @param[out]    out     Filtered samples, may alias in.
+ * @param[in]     n       Number of samples.
+ *
+ * @attention  Same output as calling BiquadQ15_Apply on every sample.
+ *
+ * @return
+ *  - None
+ */
+void BiquadQ15_ApplyBlock(BiquadQ15* biquad, const int16_t* in, int16_t* out, size_t n);
+
+#endif /* INC_BIQUAD_H_ */
+/* End of file -------------------------------------------------------- */
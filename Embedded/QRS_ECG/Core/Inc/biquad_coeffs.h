@@ -0,0 +1,78 @@
+/**
+ * @file       biquad_coeffs.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Butterworth bandpass 0.5-40 Hz, order 2, as biquad cascades.
+ *
+ * @note       Generated by evaluate/src/gen_biquad.py, do not edit.
+ *             Stage layout {b0, b1, b2, -a1, -a2}.
+ * @example    biquad.h
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_BIQUAD_COEFFS_H_
+#define INC_BIQUAD_COEFFS_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define BIQUAD_BP_LOW_HZ   (0.5)
+#define BIQUAD_BP_HIGH_HZ  (40.0)
+#define BIQUAD_BP_STAGES   (2)
+
+/* Public variables --------------------------------------------------- */
+#define BIQUAD_BP_200HZ_Q31_SHIFT (1)
+#define BIQUAD_BP_200HZ_Q15_SHIFT (1)
+static const int32_t biquad_bp_200hz_q31[] = {
+    434745161, 0, -434745161, 411531813, -217741206,
+    537134100, 0, -537134100, 2123637633, -1050163490,
+};
+
+static const int16_t biquad_bp_200hz_q15[] = {
+    6634, 0, -6634, 6279, -3322,
+    8196, 0, -8196, 32404, -16024,
+};
+
+#define BIQUAD_BP_250HZ_Q31_SHIFT (1)
+#define BIQUAD_BP_250HZ_Q15_SHIFT (1)
+static const int32_t biquad_bp_250hz_q31[] = {
+    413654480, 0, -413654480, 736157452, -279920233,
+    397015001, 0, -397015001, 2128408356, -1054838434,
+};
+
+static const int16_t biquad_bp_250hz_q15[] = {
+    6312, 0, -6312, 11233, -4271,
+    6058, 0, -6058, 32477, -16096,
+};
+
+#define BIQUAD_BP_360HZ_Q31_SHIFT (1)
+#define BIQUAD_BP_360HZ_Q15_SHIFT (1)
+static const int32_t biquad_bp_360hz_q31[] = {
+    355662298, 0, -355662298, 1145781771, -412568382,
+    255317506, 0, -255317506, 2134238206, -1060579597,
+};
+
+static const int16_t biquad_bp_360hz_q15[] = {
+    5427, 0, -5427, 17483, -6295,
+    3896, 0, -3896, 32566, -16183,
+};
+
+#define BIQUAD_BP_500HZ_Q31_SHIFT (1)
+#define BIQUAD_BP_500HZ_Q15_SHIFT (1)
+static const int32_t biquad_bp_500hz_q31[] = {
+    293058197, 0, -293058197, 1416414316, -537504811,
+    177588094, 0, -177588094, 2137947496, -1064248906,
+};
+
+static const int16_t biquad_bp_500hz_q15[] = {
+    4472, 0, -4472, 21613, -8202,
+    2710, 0, -2710, 32622, -16239,
+};
+
+#endif /* INC_BIQUAD_COEFFS_H_ */
+/* End of file -------------------------------------------------------- */
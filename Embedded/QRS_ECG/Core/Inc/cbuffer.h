@@ -8,9 +8,11 @@
  *
  * @brief      Circular Buffer implementation for STM32.
  *             This Circular Buffer is safe to use in IRQ with single reader,
- *             single writer. No need to disable any IRQ.
+ *             single writer on a single core. No need to disable any IRQ.
+ *             For multicore hosts use spsc_ring.h.
  *
- * @note       Capacity = size - 1. Should use correct size of buffer when init.
+ * @note       Power-of-two size: free-running indices, capacity = size.
+ *             Other sizes: indices wrap at size, capacity = size - 1.
  * @example    main.c
  *             Main application using Circular Buffer to store ADC data.
  */
@@ -32,41 +34,101 @@
 #define CB_SUCCESS  (0x00000000) /*!< Success return value */
 
 /* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief What cb_write does when the buffer is full.
+ */
+typedef enum
+{
+    CB_POLICY_DROP_NEW = 0, /**< Keep stored data, truncate the new write */
+    CB_POLICY_OVERWRITE     /**< Overwrite the oldest data, needs power-of-two size */
+} cb_policy_t;
+
+/**
+ * @brief Cumulative loss accounting, in elements.
+ */
+typedef struct
+{
+    uint32_t dropped;         /**< Total elements lost */
+    uint32_t overflow_events; /**< Number of writes that lost data */
+    uint32_t high_water;      /**< Highest fill level seen by the writer */
+} cb_stats_t;
+
+/**
+ * @brief Watermark callback, runs in the writer's context (e.g. IRQ).
+ */
+typedef void (*cb_watermark_cb_t)(void *arg);
+
 /**
  * @brief Circular buffer structure definition.
+ *
+ * @note  When size is a power of two, writer and reader are free-running
+ *        32-bit counters and the position in data is (index & mask).
+ *        Occupancy is (writer - reader), which stays correct across the
+ *        2^32 wraparound. Otherwise mask is 0 and both indices wrap at size.
  */
 typedef struct
 {
-    uint8_t *data;              /**< Pointer to buffer */
-    uint32_t size;              /**< Size of buffer */
-    volatile uint32_t writer;   /**< Position to write */
-    volatile uint32_t reader;   /**< Position to read */
-    volatile uint32_t overflow; /**< How many bytes are overflow */
-    volatile bool active;       /**< Initialized or not */
+    uint8_t *data;                     /**< Pointer to buffer */
+    uint32_t size;                     /**< Size of buffer */
+    uint32_t mask;                     /**< size - 1 for power-of-two size, 0 otherwise */
+    uint32_t elem_size;                /**< Size of one element, data moves in whole elements */
+    cb_policy_t policy;                /**< What to do when a write does not fit */
+    volatile uint32_t writer;          /**< Index to write */
+    volatile uint32_t reader;          /**< Index to read */
+    volatile uint32_t overflow;        /**< How many bytes the last write lost or left overwritten */
+    volatile uint32_t dropped;         /**< Bytes lost in total (writer: drop-new, reader: overwrite) */
+    volatile uint32_t overflow_events; /**< Writes that lost data (writer side) */
+    volatile uint32_t high_water;      /**< Highest fill level in bytes (writer side) */
+    uint32_t watermark;                /**< Fill level in bytes that fires watermark_cb */
+    volatile cb_watermark_cb_t watermark_cb; /**< Called when the fill level crosses watermark */
+    void *watermark_arg;               /**< Argument passed to watermark_cb */
+    volatile bool active;              /**< Initialized or not */
 } cbuffer_t;
 
 /* Public function prototypes ----------------------------------------- */
 /**
  * @brief  Initialize circular buffer.
  *
- * @param[inout]  cb    Pointer to a cbuffer_t structure.
- * @param[in]     buf   Pointer to array.
- * @param[in]     size  Size of buffer.
+ * @param[inout]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]     buf     Pointer to array.
+ * @param[in]     size    Size of buffer.
+ * @param[in]     policy  What to do when a write does not fit.
  *
- * @attention  Must be called before using the buffer.
+ * @attention  Must be called before using the buffer. A power-of-two size
+ *             selects the free-running mode where all slots are usable.
  *
  * @return
  *  - (0) : Success
  *  - (-1): Error
  */
-uint32_t cb_init(cbuffer_t *cb, void *buf, uint32_t size);
+uint32_t cb_init(cbuffer_t *cb, void *buf, uint32_t size, cb_policy_t policy);
+
+/**
+ * @brief  Initialize circular buffer holding fixed-size elements.
+ *
+ * @param[inout]  cb         Pointer to a cbuffer_t structure.
+ * @param[in]     buf        Pointer to array.
+ * @param[in]     size       Size of buffer in bytes.
+ * @param[in]     elem_size  Size of one element in bytes.
+ * @param[in]     policy     What to do when a write does not fit.
+ *
+ * @attention  size must be a multiple of elem_size. Read, write, peek and
+ *             reserve only ever move whole elements, so a reader never sees
+ *             a partially written element. Counts stay in bytes.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t cb_init_elem(cbuffer_t *cb, void *buf, uint32_t size, uint32_t elem_size, cb_policy_t policy);
 
 /**
  * @brief  Clear circular buffer.
  *
  * @param[inout]  cb  Pointer to a cbuffer_t structure.
  *
- * @attention  Resets the buffer to initial state.
+ * @attention  Resets the buffer to initial state. Loss statistics are
+ *             cumulative and are kept.
  *
  * @return
  *  - (0) : Success
@@ -96,7 +158,8 @@ uint32_t cb_read(cbuffer_t *cb, void *buf, uint32_t nbytes);
  * @param[in]     buf     Pointer to data buffer.
  * @param[in]     nbytes  Size of data to write.
  *
- * @attention  Writes up to nbytes to the buffer.
+ * @attention  Writes up to nbytes to the buffer. With CB_POLICY_OVERWRITE
+ *             all nbytes are accepted and the oldest unread data is lost.
  *
  * @return
  *  - Number of successfully written bytes: Success
@@ -130,5 +193,104 @@ uint32_t cb_data_count(cbuffer_t *cb);
  */
 uint32_t cb_space_count(cbuffer_t *cb);
 
+/**
+ * @brief  Get a pointer to the oldest stored data without copying it.
+ *
+ * @param[in]   cb   Pointer to a cbuffer_t structure.
+ * @param[out]  ptr  Pointer to the first readable byte inside the buffer.
+ *
+ * @attention  Only the contiguous part up to the end of the array is
+ *             returned. Call cb_consume, then peek again for the part that
+ *             wrapped to the start of the array. With CB_POLICY_OVERWRITE
+ *             the writer may overwrite peeked data; cb_consume reports it.
+ *
+ * @return
+ *  - Number of contiguous readable bytes at *ptr: Success
+ *  - (-1): Error
+ */
+uint32_t cb_peek_contiguous(cbuffer_t *cb, void **ptr);
+
+/**
+ * @brief  Release data previously obtained with cb_peek_contiguous.
+ *
+ * @param[inout]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]     nbytes  Number of bytes to release.
+ *
+ * @attention  nbytes must not exceed the stored data and must be a whole
+ *             number of elements. With CB_POLICY_OVERWRITE an error also
+ *             means the peeked data was overwritten and must be discarded;
+ *             the reader has then been moved to the oldest valid data.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t cb_consume(cbuffer_t *cb, uint32_t nbytes);
+
+/**
+ * @brief  Get a pointer to free space inside the buffer for in-place writes.
+ *
+ * @param[in]   cb   Pointer to a cbuffer_t structure.
+ * @param[out]  ptr  Pointer to the first writable byte inside the buffer.
+ *
+ * @attention  Only the contiguous part up to the end of the array is
+ *             returned. Call cb_commit, then reserve again for the part that
+ *             wraps to the start of the array.
+ *
+ * @return
+ *  - Number of contiguous writable bytes at *ptr: Success
+ *  - (-1): Error
+ */
+uint32_t cb_reserve(cbuffer_t *cb, void **ptr);
+
+/**
+ * @brief  Publish data written in place after cb_reserve.
+ *
+ * @param[inout]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]     nbytes  Number of bytes to publish.
+ *
+ * @attention  nbytes must not exceed the free space and must be a whole
+ *             number of elements.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t cb_commit(cbuffer_t *cb, uint32_t nbytes);
+
+/**
+ * @brief  Get cumulative loss statistics.
+ *
+ * @param[in]   cb     Pointer to a cbuffer_t structure.
+ * @param[out]  stats  Pointer to a cb_stats_t structure.
+ *
+ * @attention  Call from the reader side. Counts are in elements.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t cb_get_stats(cbuffer_t *cb, cb_stats_t *stats);
+
+/**
+ * @brief  Register a fill-level watermark.
+ *
+ * @param[inout]  cb        Pointer to a cbuffer_t structure.
+ * @param[in]     level     Fill level in bytes, 1..size.
+ * @param[in]     callback  Function to call, NULL to disarm.
+ * @param[in]     arg       Argument passed to callback.
+ *
+ * @attention  The callback fires from cb_write/cb_commit, in the writer's
+ *             context, only when a write takes the fill level from below
+ *             level to level or above. It does not fire again while the
+ *             level stays above, so the reader should drain until the
+ *             level is back below before waiting for the next event.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t cb_set_watermark(cbuffer_t *cb, uint32_t level, cb_watermark_cb_t callback, void *arg);
+
 #endif /* INC_CBUFFER_H_ */
 /* End of file -------------------------------------------------------- */
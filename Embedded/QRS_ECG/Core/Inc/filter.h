@@ -2,13 +2,14 @@
  * @file       filter.h
  * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
  * @license    This project is released under the VB's License.
- * @version    1.0.1
- * @date       2025-04-09
+ * @version    1.2.0
+ * @date       2026-10-17
  * @author     Binh Nguyen
  *
  * @brief      Header file for signal filtering functions on STM32.
  *
- * @note       This file provides a Bandpass Filter for filtering ADC signals.
+ * @note       This file provides a Bandpass Filter for filtering ADC signals,
+ *             for one channel or for a bank of leads filtered together.
  * @example    main.c
  *             Main application using the filter to filter ADC data.
  */
@@ -18,11 +19,20 @@
 #define INC_FILTER_H_
 
 /* Includes ----------------------------------------------------------- */
+#include <stddef.h>
 #include <stdint.h>
 
 /* Public defines ----------------------------------------------------- */
 #define BANDPASS_LOWPASS_WINDOW_SIZE 5
-#define BANDPASS_HIGHPASS_WINDOW_SIZE 64
+#define BANDPASS_HIGHPASS_WINDOW_SIZE 64 /* Must stay a power of two */
+#define BANDPASS_LOWPASS_SCALE 384        /* Low-pass output (sum * 384) >> 10, DC gain 15/8 */
+#define BANDPASS_LOWPASS_SHIFT 10
+#define BANDPASS_HIGHPASS_SHIFT 7         /* Subtracted average is highpass_sum >> 7 */
+#define BANDPASS_Q15_HISTORY_SIZE 8       /* Power of two above BANDPASS_LOWPASS_WINDOW_SIZE */
+#define BANDPASS_BANK_MAX_LEADS 12        /* Must stay even, leads are paired in halfwords */
+
+#define BANDPASS_ERROR    (0xFFFFFFFF) /*!< Error return value */
+#define BANDPASS_SUCCESS  (0x00000000) /*!< Success return value */
 
 /* Public enumerate/structure ----------------------------------------- */
 /**
@@ -31,10 +41,45 @@
 typedef struct {
     int32_t lowpass_buffer[BANDPASS_LOWPASS_WINDOW_SIZE];    /*!< Buffer for low-pass filter (cutoff ~40 Hz) */
     int32_t highpass_buffer[BANDPASS_HIGHPASS_WINDOW_SIZE];   /*!< Buffer for high-pass filter (cutoff ~0.5 Hz) */
-    uint8_t lowpass_index;                                    /*!< Current index for low-pass buffer */
-    uint16_t highpass_index;                                  /*!< Current index for high-pass buffer */
+    int32_t lowpass_sum;                                      /*!< Running sum of lowpass_buffer */
+    int32_t highpass_sum;                                     /*!< Running sum of highpass_buffer */
+    uint8_t lowpass_index;                                    /*!< Oldest entry of low-pass buffer */
+    uint16_t highpass_index;                                  /*!< Oldest entry of high-pass buffer */
 } BandpassFilter;
 
+/**
+ * @brief Bandpass Filter state for the packed-halfword (Q15) kernel.
+ *
+ * @note  Same filter as BandpassFilter, stored as int16_t so two samples
+ *        travel in one 32-bit register. Input history is kept twice
+ *        (lowpass_history[i] == lowpass_history[i + 8]) so the pair x[n-5],
+ *        x[n-4] is always contiguous.
+ */
+typedef struct {
+    int16_t lowpass_history[2 * BANDPASS_Q15_HISTORY_SIZE];    /*!< Last 8 inputs, mirrored */
+    int16_t highpass_buffer[BANDPASS_HIGHPASS_WINDOW_SIZE];     /*!< Last 64 low-pass outputs */
+    int32_t lowpass_sum;                                        /*!< Sum of the last 5 inputs */
+    int32_t highpass_sum;                                       /*!< Sum of highpass_buffer */
+    uint16_t index;                                             /*!< Samples processed, mod 64 */
+} BandpassFilterQ15;
+
+/**
+ * @brief Bandpass Filter state for up to BANDPASS_BANK_MAX_LEADS leads.
+ *
+ * @note  Structure of arrays: row k of a window holds tap k of every lead,
+ *        so one time-step reads and writes one contiguous row per window.
+ *        Leads l and l + 1 share a 32-bit word in every row.
+ */
+typedef struct {
+    int16_t lowpass_buffer[BANDPASS_LOWPASS_WINDOW_SIZE][BANDPASS_BANK_MAX_LEADS];    /*!< Last 5 inputs per lead */
+    int16_t highpass_buffer[BANDPASS_HIGHPASS_WINDOW_SIZE][BANDPASS_BANK_MAX_LEADS];  /*!< Last 64 low-pass outputs per lead */
+    int32_t lowpass_sum[BANDPASS_BANK_MAX_LEADS];                                     /*!< Running sums per lead */
+    int32_t highpass_sum[BANDPASS_BANK_MAX_LEADS];                                    /*!< Running sums per lead */
+    uint8_t num_leads;                                                                /*!< Leads in use */
+    uint8_t lowpass_index;                                                            /*!< Oldest low-pass row */
+    uint16_t highpass_index;                                                          /*!< Oldest high-pass row */
+} BandpassFilterBank;
+
 /* Public function prototypes ----------------------------------------- */
 /**
  * @brief  Initialize the Bandpass Filter.
@@ -61,5 +106,104 @@ void BandpassFilter_Init(BandpassFilter* filter);
  */
 int32_t BandpassFilter_Apply(BandpassFilter* filter, int32_t new_sample);
 
+/**
+ * @brief  Apply the Bandpass Filter to a block of samples.
+ *
+ * @param[inout]  filter  Pointer to the BandpassFilter structure.
+ * @param[in]     in      Input samples.
+ * @param[out]    out     Filtered samples, may alias in.
+ * @param[in]     n       Number of samples.
+ *
+ * @attention  State carries across calls, so any split of a signal into
+ *             blocks gives the same output as calling BandpassFilter_Apply
+ *             on every sample. No debug output is sent.
+ *
+ * @return
+ *  - None
+ */
+void BandpassFilter_ApplyBlock(BandpassFilter* filter, const int32_t* in, int32_t* out, size_t n);
+
+/**
+ * @brief  Initialize the packed-halfword Bandpass Filter.
+ *
+ * @param[inout]  filter  Pointer to the BandpassFilterQ15 structure.
+ *
+ * @attention  Must be called before using the filter.
+ *
+ * @return
+ *  - None
+ */
+void BandpassFilterQ15_Init(BandpassFilterQ15* filter);
+
+/**
+ * @brief  Apply the Bandpass Filter to a block of samples, two at a time.
+ *
+ * @param[inout]  filter  Pointer to the BandpassFilterQ15 structure.
+ * @param[in]     in      Input samples, -8738..8737.
+ * @param[out]    out     Filtered samples, may alias in.
+ * @param[in]     n       Number of samples.
+ *
+ * @attention  Uses SSUB16/SMUAD/SSAT on Cortex-M4 and a portable C version
+ *             of the same operations elsewhere. For inputs in range the
+ *             output is bit-exact with BandpassFilter_Apply. The limit is
+ *             set by the high-pass SSUB16: low-pass outputs span up to
+ *             15/8 of the input span (5 taps * BANDPASS_LOWPASS_SCALE / 1024), and the
+ *             difference of two of them must fit in a halfword. Outside
+ *             the range the difference wraps like SSUB16. The 12-bit ADC
+ *             (0..4095) and its signed form (-4096..4095) are well inside.
+ *             State carries across calls, n may be odd.
+ *
+ * @return
+ *  - None
+ */
+void BandpassFilterQ15_ApplyBlock(BandpassFilterQ15* filter, const int16_t* in, int16_t* out, size_t n);
+
+/**
+ * @brief  Initialize a Bandpass Filter bank.
+ *
+ * @param[inout]  bank       Pointer to the BandpassFilterBank structure.
+ * @param[in]     num_leads  Number of leads, 1..BANDPASS_BANK_MAX_LEADS.
+ *
+ * @attention  Must be called before using the bank.
+ *
+ * @return
+ *  - BANDPASS_ERROR: num_leads out of range
+ *  - BANDPASS_SUCCESS: Success
+ */
+uint32_t BandpassFilterBank_Init(BandpassFilterBank* bank, uint8_t num_leads);
+
+/**
+ * @brief  Filter one time-step of every lead.
+ *
+ * @param[inout]  bank  Pointer to the BandpassFilterBank structure.
+ * @param[in]     in    num_leads samples, one per lead, -8738..8737.
+ * @param[out]    out   num_leads filtered samples, may alias in.
+ *
+ * @attention  Each lead is bit-exact with its own BandpassFilter_Apply for
+ *             inputs in range, the same limit as
+ *             BandpassFilterQ15_ApplyBlock. Uses SSUB16/SMUAD/SSAT on two leads at a time
+ *             on Cortex-M4 and a plain per-lead loop the compiler can
+ *             vectorize elsewhere.
+ *
+ * @return
+ *  - None
+ */
+void BandpassFilterBank_Step(BandpassFilterBank* bank, const int16_t* in, int16_t* out);
+
+/**
+ * @brief  Filter n time-steps of lead-interleaved data.
+ *
+ * @param[inout]  bank  Pointer to the BandpassFilterBank structure.
+ * @param[in]     in    n * num_leads samples, in[t * num_leads + lead].
+ * @param[out]    out   Filtered samples in the same layout, may alias in.
+ * @param[in]     n     Number of time-steps.
+ *
+ * @attention  State carries across calls.
+ *
+ * @return
+ *  - None
+ */
+void BandpassFilterBank_ApplyBlock(BandpassFilterBank* bank, const int16_t* in, int16_t* out, size_t n);
+
 #endif /* INC_FILTER_H_ */
 /* End of file -------------------------------------------------------- */
@@ -55,6 +55,7 @@ void Error_Handler(void);
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
+#define FRAME_SAMPLES 64 /* Samples carried by one UART frame */
 #define FRAME_SIZE 259 /* Start byte (1) + 64 raw (2 bytes each) + 64 bandpass (2 bytes each) + Checksum (1 byte) + End byte (1) */
 
 /* USER CODE BEGIN Private defines */
@@ -32,7 +32,7 @@
 /* None */
 
 /* Public variables --------------------------------------------------- */
-extern uint8_t send_flag;     /**< Flag to indicate when to send data over UART */
+extern volatile uint8_t send_flag;   /**< Flag to indicate when to send data over UART */
 extern uint32_t ADC_value;    /**< Raw ADC value read from the sensor */
 extern UART_HandleTypeDef huart2; /**< UART handle for communication */
 extern ADC_HandleTypeDef hadc1;   /**< ADC handle for reading sensor data */
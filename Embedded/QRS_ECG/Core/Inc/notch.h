@@ -0,0 +1,74 @@
+/**
+ * @file       notch.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Header file for the 50/60 Hz mains notch on STM32.
+ *
+ * @note       One Q15 biquad stage from biquad.c: zeros on the unit circle at
+ *             the mains frequency, poles at radius 0.96 (about 2.5 Hz wide
+ *             at 200 Hz), unity gain at DC. Coefficients come from
+ *             notch_coeffs.h, generated by evaluate/src/gen_biquad.py.
+ * @example    stm32f4xx_it.c
+ *             y = NotchFilter_Apply(&notch_filter, BandpassFilter_Apply(&bandpass_filter, adc));
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_NOTCH_H_
+#define INC_NOTCH_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdint.h>
+#include "biquad.h"
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Mains frequency removed by the notch.
+ */
+typedef enum {
+    NOTCH_MAINS_50HZ = 0,   /*!< 50 Hz grid */
+    NOTCH_MAINS_60HZ        /*!< 60 Hz grid */
+} NotchMains;
+
+/**
+ * @brief Structure to store data for the mains notch.
+ */
+typedef struct {
+    BiquadQ15 biquad;         /*!< Notch stage */
+    BiquadStateQ15 state;     /*!< Delay line of the stage */
+} NotchFilter;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize the mains notch for a 200 Hz sample rate.
+ *
+ * @param[inout]  filter  Pointer to the NotchFilter structure.
+ * @param[in]     mains   Mains frequency to remove.
+ *
+ * @attention  Must be called before using the filter. Calling it again
+ *             switches the frequency and clears the state.
+ *
+ * @return
+ *  - None
+ */
+void NotchFilter_Init(NotchFilter* filter, NotchMains mains);
+
+/**
+ * @brief  Apply the mains notch to a new sample.
+ *
+ * @param[inout]  filter      Pointer to the NotchFilter structure.
+ * @param[in]     new_sample  Bandpass output, int16 range.
+ *
+ * @attention  Meant to run on the output of BandpassFilter_Apply. The
+ *             result saturates to the int16 range.
+ *
+ * @return
+ *  - Filtered value (int32_t)
+ */
+int32_t NotchFilter_Apply(NotchFilter* filter, int32_t new_sample);
+
+#endif /* INC_NOTCH_H_ */
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,39 @@
+/**
+ * @file       notch_coeffs.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Mains notch 50/60 Hz, pole radius 0.96, as single biquads.
+ *
+ * @note       Generated by evaluate/src/gen_biquad.py, do not edit.
+ *             Stage layout {b0, b1, b2, -a1, -a2}.
+ * @example    biquad.h
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_NOTCH_COEFFS_H_
+#define INC_NOTCH_COEFFS_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define BIQUAD_NOTCH_RADIUS (0.96)
+#define BIQUAD_NOTCH_STAGES (1)
+
+/* Public variables --------------------------------------------------- */
+#define BIQUAD_NOTCH50_FS200_Q15_SHIFT (0)
+static const int16_t biquad_notch50_fs200_q15[] = {
+    31483, 0, 31483, 0, -30199,
+};
+
+#define BIQUAD_NOTCH60_FS200_Q15_SHIFT (0)
+static const int16_t biquad_notch60_fs200_q15[] = {
+    31477, 19454, 31477, -19442, -30199,
+};
+
+#endif /* INC_NOTCH_COEFFS_H_ */
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,169 @@
+/**
+ * @file       pan_tompkins.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Header file for the fixed-point Pan-Tompkins QRS detector on STM32.
+ *
+ * @note       Stages after BandpassFilter_Apply, all integer and O(1) per sample:
+ *               derivative   y = (2x[n] + x[n-1] - x[n-3] - 2x[n-4]) / 8
+ *               squaring     y = x^2, saturated at PAN_TOMPKINS_SQUARE_MAX
+ *               integration  mean of the last PAN_TOMPKINS_MWI_WINDOW values
+ *             Peaks of the integrated signal are classified against the
+ *             adaptive thresholds of Pan and Tompkins (1985):
+ *               SPKI/NPKI    signal and noise peak levels, 1/8 update
+ *               THRESHOLD1   NPKI + (SPKI - NPKI) / 4, THRESHOLD2 = THRESHOLD1 / 2
+ *               refractory   no QRS within 200 ms of the previous one
+ *               T wave       within 360 ms, slope below half the previous QRS
+ *               searchback   no QRS for 166% of the regular RR average: take
+ *                            the largest peak since above THRESHOLD2
+ *             Only the integrated-signal thresholds are used; the R peak is
+ *             the maximum of the bandpass input under the integration
+ *             window. After PAN_TOMPKINS_SETTLE_SAMPLES of filter start-up,
+ *             PAN_TOMPKINS_LEARN_SAMPLES samples only train the thresholds.
+ * @example    pan_tompkins.h
+ *             PanTompkins_Init(&pt);
+ *             if (PanTompkins_Push(&pt, BandpassFilter_Apply(&filter, adc), &peak)) { ... }
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_PAN_TOMPKINS_H_
+#define INC_PAN_TOMPKINS_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdint.h>
+#include "qrs_detector.h"
+
+/* Public defines ----------------------------------------------------- */
+#define PAN_TOMPKINS_MWI_WINDOW 32          /* 160 ms at 200 Hz, power of two */
+#define PAN_TOMPKINS_MWI_SHIFT 5            /* log2(PAN_TOMPKINS_MWI_WINDOW) */
+#define PAN_TOMPKINS_SQUARE_MAX (1 << 24)   /* Keeps the integration sum in int32 */
+#define PAN_TOMPKINS_INPUT_SIZE 64          /* Bandpass lookback for the R peak, power of two */
+#define PAN_TOMPKINS_DELAY 2                /* Derivative group delay, samples */
+#define PAN_TOMPKINS_PEAK_TIMEOUT 19        /* 95 ms: a peak that stops rising is taken */
+#define PAN_TOMPKINS_REFRACTORY 40          /* 200 ms */
+#define PAN_TOMPKINS_T_WAVE 72              /* 360 ms */
+#define PAN_TOMPKINS_SETTLE_SAMPLES 100     /* 0.5 s of bandpass start-up, ignored */
+#define PAN_TOMPKINS_LEARN_SAMPLES 400      /* 2 s */
+#define PAN_TOMPKINS_RR_COUNT 8             /* RR intervals in each average */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Structure to store data for the Pan-Tompkins detector.
+ */
+typedef struct {
+    int32_t input[PAN_TOMPKINS_INPUT_SIZE];     /*!< Bandpass samples, indexed by sample index */
+    int32_t derivative_history[4];              /*!< x[n-1] .. x[n-4] */
+    int32_t mwi_buffer[PAN_TOMPKINS_MWI_WINDOW]; /*!< Squared values in the window */
+    int32_t mwi_sum;                            /*!< Their sum */
+    uint32_t sample_index;                      /*!< Index of the next sample */
+
+    int32_t peak_value;                         /*!< Integrated peak being tracked */
+    uint32_t peak_index;                        /*!< Its sample index */
+    int32_t slope;                              /*!< Largest |derivative| since the last peak */
+    int32_t peak_slope;                         /*!< slope when the tracked peak was reached */
+
+    int32_t spki;                               /*!< Signal peak level */
+    int32_t npki;                               /*!< Noise peak level */
+    int32_t threshold1;                         /*!< NPKI + (SPKI - NPKI) / 4 */
+    int32_t threshold2;                         /*!< threshold1 / 2, searchback */
+    int32_t learn_max;                          /*!< Largest integrated value while learning */
+    int64_t learn_sum;                          /*!< Sum of integrated values while learning */
+
+    uint16_t rr_recent[PAN_TOMPKINS_RR_COUNT];  /*!< Last RR intervals */
+    uint16_t rr_regular[PAN_TOMPKINS_RR_COUNT]; /*!< Last RR intervals within 92-116% */
+    uint32_t rr_recent_sum;                     /*!< Sum of rr_recent */
+    uint32_t rr_regular_sum;                    /*!< Sum of rr_regular */
+    uint8_t rr_index;                           /*!< Next rr_recent slot */
+    uint8_t rr_regular_index;                   /*!< Next rr_regular slot */
+    uint8_t rr_irregular;                       /*!< Irregular intervals in a row */
+    uint16_t rr_missed;                         /*!< 166% of the regular average */
+
+    uint32_t last_qrs;                          /*!< Index of the last QRS integrated peak */
+    int32_t last_slope;                         /*!< Its slope */
+    uint32_t last_r;                            /*!< Index of the last reported R peak */
+    uint16_t qrs_count;                         /*!< QRS complexes found */
+
+    uint8_t searchback_valid;                   /*!< A noise peak is kept for searchback */
+    int32_t searchback_value;                   /*!< Largest noise peak since the last QRS */
+    uint32_t searchback_index;                  /*!< Its integrated peak index */
+    int32_t searchback_slope;                   /*!< Its slope */
+    uint32_t searchback_r;                      /*!< Its R peak index */
+    int32_t searchback_amplitude;               /*!< Its R peak amplitude */
+} PanTompkins;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize the Pan-Tompkins detector.
+ *
+ * @param[inout]  pt  Pointer to the PanTompkins structure.
+ *
+ * @attention  Must be called before using the detector.
+ *
+ * @return
+ *  - None
+ */
+void PanTompkins_Init(PanTompkins* pt);
+
+/**
+ * @brief  Derivative stage, 2-sample group delay.
+ *
+ * @param[inout]  pt  Pointer to the PanTompkins structure.
+ * @param[in]     x   Bandpass filtered sample.
+ *
+ * @attention  Keeps 4 samples of history in pt.
+ *
+ * @return
+ *  - Slope (int32_t)
+ */
+int32_t PanTompkins_Derivative(PanTompkins* pt, int32_t x);
+
+/**
+ * @brief  Squaring stage.
+ *
+ * @param[in]  x  Derivative output.
+ *
+ * @attention  Saturates at PAN_TOMPKINS_SQUARE_MAX.
+ *
+ * @return
+ *  - x^2 (int32_t)
+ */
+int32_t PanTompkins_Square(int32_t x);
+
+/**
+ * @brief  Moving window integration stage, running sum.
+ *
+ * @param[inout]  pt  Pointer to the PanTompkins structure.
+ * @param[in]     x   Squared value.
+ *
+ * @attention  None
+ *
+ * @return
+ *  - Mean over PAN_TOMPKINS_MWI_WINDOW values (int32_t)
+ */
+int32_t PanTompkins_Integrate(PanTompkins* pt, int32_t x);
+
+/**
+ * @brief  Run all stages and the decision rules on one bandpass sample.
+ *
+ * @param[inout]  pt      Pointer to the PanTompkins structure.
+ * @param[in]     sample  Output of BandpassFilter_Apply.
+ * @param[out]    peak    Filled when an R peak is reported.
+ *
+ * @attention  Peaks found above THRESHOLD1 are reported at most
+ *             PAN_TOMPKINS_DELAY + PAN_TOMPKINS_MWI_WINDOW +
+ *             PAN_TOMPKINS_PEAK_TIMEOUT samples after the R peak. Searchback
+ *             peaks are reported when the RR interval runs out. Peaks are
+ *             reported in order.
+ *
+ * @return
+ *  - 1: peak holds a new R peak
+ *  - 0: No peak reported
+ */
+uint8_t PanTompkins_Push(PanTompkins* pt, int32_t sample, QRSPeak* peak);
+
+#endif /* INC_PAN_TOMPKINS_H_ */
+/* End of file -------------------------------------------------------- */
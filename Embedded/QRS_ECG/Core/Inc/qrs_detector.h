@@ -2,15 +2,26 @@
  * @file       qrs_detector.h
  * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
  * @license    This project is released under the VB's License.
- * @version    1.1.0
- * @date       2025-05-11
+ * @version    1.3.0
+ * @date       2026-10-17
  * @author     Binh Nguyen
  *
  * @brief      Header file for QRS detection algorithm on STM32.
  *
  * @note       This file provides functions for detecting QRS complexes in ECG signals using low static threshold with smart post-processing.
- * @example    main.c
- *             Main application using the QRS detector to identify QRS complexes.
+ *             QRSDetector_Detect works on a complete 2000-sample block. QRSDetector_Push runs the same
+ *             candidate, merge and refine steps one sample at a time on a QRS_STREAM_RING_SIZE lookback ring,
+ *             and reports each peak at most QRS_STREAM_LATENCY samples after the peak itself. A detector is used
+ *             in one of the two modes; QRSDetector_Init resets both. All working storage is inside QRSDetector,
+ *             so the caller decides where it lives; neither mode puts arrays on the stack. The firmware
+ *             does not run the detector yet, the host benches in evaluate/bench keep one static instance.
+ *             QRSDetector_DetectRecord runs Push and Flush over a record of any length in one forward pass
+ *             and writes peak indices to a caller buffer, so a 120 s GUI window or a 24 h Holter record uses
+ *             the same fixed-size detector.
+ * @example    qrs_stream_bench.c
+ *             Host bench running QRSDetector_Push sample by sample on record 100.
+ *             QRSPeak peak;
+ *             if (QRSDetector_Push(&detector, BandpassFilter_Apply(&filter, adc), &peak)) { ... }
  */
 
 /* Define to prevent recursive inclusion ------------------------------ */
@@ -27,15 +38,46 @@
 #define QRS_MIN_AMPLITUDE 1000
 #define QRS_PEAK_WINDOW 2
 #define QRS_PEAK_REFINE_WINDOW 10
+#define QRS_MIN_DISTANCE_FLOOR 30
+#define QRS_STREAM_RING_SIZE 128   /* Lookback ring of QRSDetector_Push, power of two */
+#define QRS_STREAM_MEAN_SHIFT 10   /* Running mean follows the signal over 2^10 samples (5.12 s) */
+#define QRS_STREAM_LATENCY (QRS_MIN_DISTANCE + 2 * QRS_PEAK_REFINE_WINDOW) /* 100 samples, 500 ms */
 
 /* Public enumerate/structure ----------------------------------------- */
 /**
  * @brief Structure to store data for the QRS Detector.
  */
 typedef struct {
-    uint16_t peak_count;       /* Number of detected peaks */
+    uint16_t peak_count;                 /* Number of detected peaks */
+
+    /* QRSDetector_Detect candidates (index, raw sample); the candidate test stops at QRS_MAX_PEAKS */
+    uint16_t candidate_index[QRS_MAX_PEAKS];
+    int32_t candidate_value[QRS_MAX_PEAKS];
+
+    /* QRSDetector_Push state */
+    int32_t ring[QRS_STREAM_RING_SIZE];  /* Mean-removed samples, indexed by sample index */
+    int32_t mean_acc;                    /* Running mean << QRS_STREAM_MEAN_SHIFT */
+    uint32_t sample_index;               /* Index of the next sample */
+    uint32_t next_candidate;             /* First index allowed to be a candidate */
+    uint32_t group_start;                /* First candidate of the open group */
+    uint32_t group_index;                /* Largest candidate of the open group */
+    int32_t group_value;                 /* Its value */
+    uint32_t pending_index;              /* Closed group waiting for its refine window */
+    uint32_t last_peak;                  /* Index of the last reported peak */
+    uint16_t rr_average;                 /* Running RR interval, samples */
+    uint16_t min_distance;               /* Group length, half the RR interval */
+    uint8_t group_open;                  /* A group is collecting candidates */
+    uint8_t pending;                     /* pending_index is valid */
 } QRSDetector;
 
+/**
+ * @brief One peak reported by QRSDetector_Push.
+ */
+typedef struct {
+    uint32_t index;                      /* Sample index, counted from QRSDetector_Init */
+    int32_t value;                       /* Mean-removed amplitude */
+} QRSPeak;
+
 /* Public function prototypes ----------------------------------------- */
 /**
  * @brief  Initialize the QRS Detector.
@@ -63,5 +105,58 @@ void QRSDetector_Init(QRSDetector* detector);
  */
 void QRSDetector_Detect(QRSDetector* detector, int32_t* signal, uint8_t* qrs_flags);
 
+/**
+ * @brief  Feed one filtered sample to the streaming detector.
+ *
+ * @param[inout]  detector  Pointer to the QRSDetector structure.
+ * @param[in]     sample    Next filtered ECG sample.
+ * @param[out]    peak      Filled when a peak is reported.
+ *
+ * @attention  A peak at index i is reported by the push of a sample in
+ *             [i, i + QRS_STREAM_LATENCY]. Peaks are reported in order.
+ *             O(1) per sample, apart from one 21-sample refine scan per peak.
+ *
+ * @return
+ *  - 1: peak holds a new peak
+ *  - 0: No peak reported
+ */
+uint8_t QRSDetector_Push(QRSDetector* detector, int32_t sample, QRSPeak* peak);
+
+/**
+ * @brief  Report the groups still open at the end of the input.
+ *
+ * @param[inout]  detector  Pointer to the QRSDetector structure.
+ * @param[out]    peak      Filled when a peak is reported.
+ *
+ * @attention  Call after the last QRSDetector_Push, repeatedly until it
+ *             returns 0. Refine windows are cut at the last sample, and the
+ *             last QRS_PEAK_WINDOW samples are never candidates.
+ *
+ * @return
+ *  - 1: peak holds a new peak
+ *  - 0: Nothing left to report
+ */
+uint8_t QRSDetector_Flush(QRSDetector* detector, QRSPeak* peak);
+
+/**
+ * @brief  Detect QRS complexes in a filtered record of any length.
+ *
+ * @param[inout]  detector  Pointer to the QRSDetector structure.
+ * @param[in]     signal    Filtered ECG samples.
+ * @param[in]     length    Number of samples.
+ * @param[out]    peaks     Sample indices of the peaks, ascending.
+ * @param[in]     capacity  Number of entries peaks can hold.
+ *
+ * @attention  Resets the detector, then one QRSDetector_Push per sample and
+ *             QRSDetector_Flush at the end. Only the first capacity peaks
+ *             are written; the return value still counts all of them, so a
+ *             result above capacity means peaks were dropped.
+ *
+ * @return
+ *  - Number of peaks detected
+ */
+uint32_t QRSDetector_DetectRecord(QRSDetector* detector, const int32_t* signal, uint32_t length, uint32_t* peaks,
+                                  uint32_t capacity);
+
 #endif /* INC_QRS_DETECTOR_H_ */
 /* End of file -------------------------------------------------------- */
@@ -0,0 +1,197 @@
+/**
+ * @file       ring.hpp
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.1.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Header-only typed ring buffer for host tools.
+ *
+ * @note       Ring<T, N> keeps N records of type T in a plain array with
+ *             free-running 32-bit counters and mask indexing, the same
+ *             scheme cbuffer_t uses for power-of-two sizes. The record
+ *             array has the layout of a cbuffer data array initialized with
+ *             cb_init_elem(..., sizeof(T)), so Ring<adc_sample_t,
+ *             ADC_SAMPLE_RING_SIZE> matches adc_buffer_data. Counters here
+ *             count records, cbuffer counts bytes (records * sizeof(T)).
+ *             Single producer, single consumer, also across host threads:
+ *             the side that owns an index stores it with release after its
+ *             copy, the other side loads it with acquire. Without <atomic>
+ *             (bare-metal C++ without libstdc++) the indices fall back to
+ *             volatile plus the same compiler barrier as CB_BARRIER, which
+ *             is only enough on a single core.
+ * @example    ring.hpp
+ *             Ring<adc_sample_t, ADC_SAMPLE_RING_SIZE> ring;
+ *             ring.write(&sample, 1);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_RING_HPP_
+#define INC_RING_HPP_
+
+/* Includes ----------------------------------------------------------- */
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifndef RING_HAS_ATOMIC
+#if defined(__has_include)
+#if __has_include(<atomic>)
+#define RING_HAS_ATOMIC (1) /*!< 1: std::atomic indices, 0: volatile and barrier */
+#endif
+#endif
+#endif
+#ifndef RING_HAS_ATOMIC
+#define RING_HAS_ATOMIC (0)
+#endif
+#if RING_HAS_ATOMIC
+#include <atomic>
+#endif
+
+/* Public class ------------------------------------------------------- */
+/**
+ * @brief Fixed-capacity ring of trivially copyable records.
+ *
+ * @tparam T  Record type.
+ * @tparam N  Number of records, must be a power of two.
+ */
+template <typename T, uint32_t N>
+class Ring
+{
+    static_assert(N > 1 && (N & (N - 1)) == 0, "N must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+    static constexpr uint32_t kMask = N - 1; /**< Index mask */
+
+    /**
+     * @brief  Number of records stored.
+     */
+    uint32_t count() const { return acquire(writer_) - acquire(reader_); }
+
+    /**
+     * @brief  Number of free record slots.
+     */
+    uint32_t space() const { return N - count(); }
+
+    /**
+     * @brief  Drop all records. Not safe while the other side is running.
+     */
+    void clear() { release(writer_, 0); release(reader_, 0); }
+
+    /**
+     * @brief  Write up to n records. Producer side only.
+     *
+     * @return Number of records written.
+     */
+    uint32_t write(const T *src, uint32_t n)
+    {
+        uint32_t writer = relaxed(writer_);
+        uint32_t space = N - (writer - acquire(reader_));
+        if (n > space)
+            n = space;
+
+        uint32_t first = split(writer, n);
+        std::memcpy(data_ + (writer & kMask), src, first * sizeof(T));
+        std::memcpy(data_, src + first, (n - first) * sizeof(T));
+        release(writer_, writer + n);
+        return n;
+    }
+
+    /**
+     * @brief  Read up to n records. Consumer side only.
+     *
+     * @return Number of records read.
+     */
+    uint32_t read(T *dst, uint32_t n)
+    {
+        uint32_t reader = relaxed(reader_);
+        uint32_t avail = acquire(writer_) - reader;
+        if (n > avail)
+            n = avail;
+
+        uint32_t first = split(reader, n);
+        std::memcpy(dst, data_ + (reader & kMask), first * sizeof(T));
+        std::memcpy(dst + first, data_, (n - first) * sizeof(T));
+        release(reader_, reader + n);
+        return n;
+    }
+
+    /**
+     * @brief  Get the contiguous run of oldest records without copying.
+     *         Consumer side only.
+     *
+     * @return Number of records at *ptr.
+     */
+    uint32_t peek(const T **ptr) const
+    {
+        uint32_t reader = relaxed(reader_);
+        uint32_t pos = reader & kMask;
+        uint32_t n = acquire(writer_) - reader;
+        if (n > N - pos)
+            n = N - pos;
+
+        *ptr = data_ + pos;
+        return n;
+    }
+
+    /**
+     * @brief  Release up to n records obtained with peek. Consumer side only.
+     *
+     * @return Number of records released, n clamped to count().
+     */
+    uint32_t consume(uint32_t n)
+    {
+        uint32_t reader = relaxed(reader_);
+        uint32_t avail = acquire(writer_) - reader;
+        if (n > avail)
+            n = avail;
+
+        release(reader_, reader + n);
+        return n;
+    }
+
+    /**
+     * @brief  Record storage, same layout as the cbuffer data array.
+     */
+    const T *data() const { return data_; }
+
+private:
+#if RING_HAS_ATOMIC
+    using Index = std::atomic<uint32_t>;
+
+    static uint32_t relaxed(const Index &index) { return index.load(std::memory_order_relaxed); }
+    static uint32_t acquire(const Index &index) { return index.load(std::memory_order_acquire); }
+    static void release(Index &index, uint32_t value) { index.store(value, std::memory_order_release); }
+#else
+    using Index = volatile uint32_t;
+
+    static uint32_t relaxed(const Index &index) { return index; }
+    static uint32_t acquire(const Index &index)
+    {
+        uint32_t value = index;
+        __asm volatile("" ::: "memory");
+        return value;
+    }
+    static void release(Index &index, uint32_t value)
+    {
+        __asm volatile("" ::: "memory");
+        index = value;
+    }
+#endif
+
+    /* Records of a n-record transfer at index that fit before the array end */
+    static uint32_t split(uint32_t index, uint32_t n)
+    {
+        uint32_t first = N - (index & kMask);
+        return first < n ? first : n;
+    }
+
+    T data_[N] = {};        /**< Record storage */
+    Index writer_{0};       /**< Free-running write counter, owned by the producer */
+    Index reader_{0};       /**< Free-running read counter, owned by the consumer */
+};
+
+#endif /* INC_RING_HPP_ */
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,135 @@
+/**
+ * @file       spsc_ring.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Single producer, single consumer ring using C11 atomics.
+ *
+ * @note       Variant of cbuffer for multicore hosts. Indices are published
+ *             with release stores and observed with acquire loads, so the
+ *             ring is correct when producer and consumer run on different
+ *             cores. The producer and consumer indices live on separate
+ *             cache lines, and each side keeps a cached copy of the peer
+ *             index so it only touches the peer's line when the cached
+ *             value says the ring is full (producer) or empty (consumer).
+ *             Count must be a power of two, all slots are usable.
+ * @example    spsc_ring.h
+ *             spsc_init(&ring, storage, 1024, sizeof(adc_sample_t));
+ *             spsc_write(&ring, &sample, 1);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_SPSC_RING_H_
+#define INC_SPSC_RING_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Public defines ----------------------------------------------------- */
+#ifndef SPSC_CACHE_LINE
+#define SPSC_CACHE_LINE (64)        /*!< Cache line size used to split indices */
+#endif
+#define SPSC_ERROR      (0xFFFFFFFF) /*!< Error return value */
+#define SPSC_SUCCESS    (0x00000000) /*!< Success return value */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief SPSC ring structure definition.
+ */
+typedef struct
+{
+    /* Producer cache line */
+    _Alignas(SPSC_CACHE_LINE) _Atomic uint32_t head; /**< Free-running write index (elements) */
+    uint32_t cached_tail;                            /**< Producer's copy of tail */
+
+    /* Consumer cache line */
+    _Alignas(SPSC_CACHE_LINE) _Atomic uint32_t tail; /**< Free-running read index (elements) */
+    uint32_t cached_head;                            /**< Consumer's copy of head */
+
+    /* Read-only after init */
+    _Alignas(SPSC_CACHE_LINE) uint8_t *data;         /**< Pointer to storage */
+    uint32_t count;                                  /**< Number of elements */
+    uint32_t mask;                                   /**< count - 1 */
+    uint32_t elem_size;                              /**< Size of one element */
+} spsc_ring_t;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize SPSC ring.
+ *
+ * @param[inout]  ring       Pointer to a spsc_ring_t structure.
+ * @param[in]     buf        Pointer to storage of count * elem_size bytes.
+ * @param[in]     count      Number of elements, power of two.
+ * @param[in]     elem_size  Size of one element in bytes.
+ *
+ * @attention  Must be called before producer and consumer start.
+ *
+ * @return
+ *  - (0) : Success
+ *  - (-1): Error
+ */
+uint32_t spsc_init(spsc_ring_t *ring, void *buf, uint32_t count, uint32_t elem_size);
+
+/**
+ * @brief  Write elements to SPSC ring. Producer side only.
+ *
+ * @param[inout]  ring   Pointer to a spsc_ring_t structure.
+ * @param[in]     items  Pointer to elements.
+ * @param[in]     n      Number of elements to write.
+ *
+ * @attention  Writes up to n elements, never blocks.
+ *
+ * @return
+ *  - Number of elements written: Success
+ *  - (-1): Error
+ */
+uint32_t spsc_write(spsc_ring_t *ring, const void *items, uint32_t n);
+
+/**
+ * @brief  Read elements from SPSC ring. Consumer side only.
+ *
+ * @param[inout]  ring   Pointer to a spsc_ring_t structure.
+ * @param[out]    items  Pointer to destination.
+ * @param[in]     n      Number of elements to read.
+ *
+ * @attention  Reads up to n elements, never blocks.
+ *
+ * @return
+ *  - Number of elements read: Success
+ *  - (-1): Error
+ */
+uint32_t spsc_read(spsc_ring_t *ring, void *items, uint32_t n);
+
+/**
+ * @brief  Return the number of elements in SPSC ring.
+ *
+ * @param[in]  ring  Pointer to a spsc_ring_t structure.
+ *
+ * @attention  Snapshot only, may be stale when the other side is running.
+ *
+ * @return
+ *  - Number of elements: Success
+ *  - (-1): Error
+ */
+uint32_t spsc_data_count(spsc_ring_t *ring);
+
+/**
+ * @brief  Return the number of free elements in SPSC ring.
+ *
+ * @param[in]  ring  Pointer to a spsc_ring_t structure.
+ *
+ * @attention  Snapshot only, may be stale when the other side is running.
+ *
+ * @return
+ *  - Number of free elements: Success
+ *  - (-1): Error
+ */
+uint32_t spsc_space_count(spsc_ring_t *ring);
+
+#endif /* INC_SPSC_RING_H_ */
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,135 @@
+/**
+ * @file       trace.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Deferred binary trace log for hot paths.
+ *
+ * @note       trace_log stores a fixed 16-byte record (timestamp, event id,
+ *             three arguments) in a Circular Buffer and returns; nothing is
+ *             formatted or sent. trace_drain runs from the main loop, wraps
+ *             each record as SYNC + record + checksum and sends it over UART.
+ *             evaluate/src/trace_decode.py turns a capture back into the
+ *             DEBUG: text lines. The ring is single producer, so each
+ *             execution context logs to its own trace: trace_irq from
+ *             interrupts, trace_app from the main loop. Logging to a trace
+ *             that was never initialized does nothing.
+ * @example    main.c
+ *             trace_init(&trace_irq, trace_irq_data, TRACE_IRQ_RECORDS);
+ *             trace_log(&trace_irq, TRACE_EV_FILTER, 0, value, 0);
+ *             trace_drain(&trace_irq, &huart2, 8);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef INC_TRACE_H_
+#define INC_TRACE_H_
+
+/* Includes ----------------------------------------------------------- */
+#include "main.h"
+#include "cbuffer.h"
+
+/* Public defines ----------------------------------------------------- */
+#define TRACE_IRQ_RECORDS (32)   /*!< Records in trace_irq, power of two */
+#define TRACE_APP_RECORDS (256)  /*!< Records in trace_app, power of two */
+#define TRACE_SYNC        (0xC5) /*!< First byte of a packet on the wire */
+#define TRACE_PACKET_SIZE (18)   /*!< SYNC + record + checksum */
+#define TRACE_ERROR       (0xFFFFFFFF) /*!< Error return value */
+#define TRACE_SUCCESS     (0x00000000) /*!< Success return value */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Event ids. Keep in sync with EVENTS in evaluate/src/trace_decode.py.
+ */
+typedef enum
+{
+    TRACE_EV_LOST = 0,             /**< arg1: records dropped since the last drain */
+    TRACE_EV_FILTER,               /**< arg1: filtered value */
+    TRACE_EV_QRS_MEAN,             /**< arg1: signal mean */
+    TRACE_EV_QRS_SAMPLE,           /**< arg0: index, arg1: mean-removed sample */
+    TRACE_EV_QRS_POTENTIAL_PEAK,   /**< arg0: index, arg1: value */
+    TRACE_EV_QRS_MIN_DISTANCE,     /**< arg0: minimum distance */
+    TRACE_EV_QRS_PEAK,             /**< arg0: index, arg1: value */
+    TRACE_EV_QRS_TOTAL             /**< arg0: number of peaks */
+} trace_event_t;
+
+/**
+ * @brief One trace record, little-endian on the wire.
+ */
+typedef struct
+{
+    uint32_t timestamp; /**< DWT cycle count (host: record sequence) */
+    uint16_t event;     /**< trace_event_t */
+    uint16_t arg0;      /**< Small argument, usually a sample index */
+    int32_t arg1;       /**< Value argument */
+    int32_t arg2;       /**< Spare argument */
+} trace_record_t;
+
+/**
+ * @brief Trace log: a ring of records plus the loss already reported.
+ */
+typedef struct
+{
+    cbuffer_t ring;          /**< Records, drop-new when full */
+    uint32_t reported_lost;  /**< Dropped bytes already sent as TRACE_EV_LOST */
+} trace_t;
+
+/* Public variables --------------------------------------------------- */
+extern trace_t trace_irq;                                /**< Written from interrupt context only */
+extern trace_t trace_app;                                /**< Written from the main loop only */
+extern trace_record_t trace_irq_data[TRACE_IRQ_RECORDS]; /**< Storage for trace_irq */
+extern trace_record_t trace_app_data[TRACE_APP_RECORDS]; /**< Storage for trace_app */
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize a trace log.
+ *
+ * @param[inout]  trace    Pointer to a trace_t structure.
+ * @param[in]     storage  Record storage.
+ * @param[in]     count    Number of records, power of two.
+ *
+ * @attention  Must be called before the first trace_log that should be
+ *             kept. Also starts the DWT cycle counter on Cortex-M.
+ *
+ * @return
+ *  - TRACE_ERROR: Error
+ *  - TRACE_SUCCESS: Success
+ */
+uint32_t trace_init(trace_t *trace, trace_record_t *storage, uint32_t count);
+
+/**
+ * @brief  Store one record. Safe in IRQ, never blocks.
+ *
+ * @param[inout]  trace  Pointer to a trace_t structure.
+ * @param[in]     event  Event id (trace_event_t).
+ * @param[in]     arg0   Small argument.
+ * @param[in]     arg1   Value argument.
+ * @param[in]     arg2   Spare argument.
+ *
+ * @attention  Only one execution context may log to a given trace. When
+ *             the ring is full the record is dropped and counted.
+ *
+ * @return
+ *  - None
+ */
+void trace_log(trace_t *trace, uint16_t event, uint16_t arg0, int32_t arg1, int32_t arg2);
+
+/**
+ * @brief  Send stored records over UART.
+ *
+ * @param[inout]  trace        Pointer to a trace_t structure.
+ * @param[in]     huart        UART to send on.
+ * @param[in]     max_records  Most records to send in this call.
+ *
+ * @attention  Blocking, call from the main loop. Drops since the previous
+ *             call are sent first as one TRACE_EV_LOST record.
+ *
+ * @return
+ *  - Number of records sent
+ */
+uint32_t trace_drain(trace_t *trace, UART_HandleTypeDef *huart, uint32_t max_records);
+
+#endif /* INC_TRACE_H_ */
+/* End of file -------------------------------------------------------- */
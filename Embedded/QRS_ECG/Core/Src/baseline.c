@@ -0,0 +1,136 @@
+/**
+ * @file       baseline.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of multirate baseline wander removal for STM32.
+ *
+ * @note       Everything is kept in block-sum units (8 x input) so the
+ *             decimator never divides. The interpolated baseline
+ *             M_prev * 8 + (M - M_prev) * phase is in 64 x input units.
+ * @example    baseline.h
+ *             Usage example in the header.
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "baseline.h"
+#include <string.h>
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Replace the oldest block sum in the median window.
+ *
+ * @param[inout]  filter     Pointer to the BaselineFilter structure.
+ * @param[in]     block_sum  Newest block sum.
+ *
+ * @attention  Internal function, not for direct use. One pass over the
+ *             sorted window: find the old value, slide towards the new
+ *             value's place, store it.
+ *
+ * @return
+ *  - None
+ */
+static void BaselineFilter_PushBlock(BaselineFilter* filter, int32_t block_sum);
+
+/**
+ * @brief  Remove the baseline from one sample, shared by both APIs.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Baseline-free value (int32_t)
+ */
+static inline int32_t BaselineFilter_Step(BaselineFilter* filter, int32_t new_sample);
+
+/* Function definitions ----------------------------------------------- */
+void BaselineFilter_Init(BaselineFilter* filter)
+{
+    memset(filter, 0, sizeof(*filter));
+}
+
+int32_t BaselineFilter_Apply(BaselineFilter* filter, int32_t new_sample)
+{
+    return BaselineFilter_Step(filter, new_sample);
+}
+
+void BaselineFilter_ApplyBlock(BaselineFilter* filter, const int32_t* in, int32_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = BaselineFilter_Step(filter, in[i]);
+    }
+}
+
+/* Private definitions ----------------------------------------------- */
+static inline int32_t BaselineFilter_Step(BaselineFilter* filter, int32_t new_sample)
+{
+    // Seed every stage with the first sample, as if it had always been there
+    if (!filter->primed) {
+        for (uint16_t i = 0; i < BASELINE_DELAY_SIZE; i++) {
+            filter->delay[i] = new_sample;
+        }
+        for (uint8_t i = 0; i < BASELINE_WINDOW; i++) {
+            filter->window[i] = new_sample * BASELINE_DECIMATION;
+            filter->sorted[i] = new_sample * BASELINE_DECIMATION;
+        }
+        filter->median_prev = new_sample * BASELINE_DECIMATION;
+        filter->median = new_sample * BASELINE_DECIMATION;
+        filter->primed = 1;
+    }
+
+    // Input delayed by the estimator's group delay
+    int32_t delayed = filter->delay[(filter->delay_index - BASELINE_DELAY) & (BASELINE_DELAY_SIZE - 1)];
+    filter->delay[filter->delay_index] = new_sample;
+    filter->delay_index = (filter->delay_index + 1) & (BASELINE_DELAY_SIZE - 1);
+
+    // Decimator: sum of BASELINE_DECIMATION samples
+    filter->block_sum += new_sample;
+    filter->phase++;
+
+    // Linear interpolation between the last two medians, 64 x input units
+    int32_t baseline = filter->median_prev * BASELINE_DECIMATION + (filter->median - filter->median_prev) * filter->phase;
+    int32_t output = delayed - ((baseline + 32) >> 6);
+
+    // Low-rate step: one median update per block
+    if (filter->phase == BASELINE_DECIMATION) {
+        BaselineFilter_PushBlock(filter, filter->block_sum);
+        filter->median_prev = filter->median;
+        filter->median = filter->sorted[BASELINE_WINDOW / 2];
+        filter->block_sum = 0;
+        filter->phase = 0;
+    }
+
+    return output;
+}
+
+static void BaselineFilter_PushBlock(BaselineFilter* filter, int32_t block_sum)
+{
+    int32_t* sorted = filter->sorted;
+    int32_t oldest = filter->window[filter->window_index];
+    filter->window[filter->window_index] = block_sum;
+    if (++filter->window_index == BASELINE_WINDOW) {
+        filter->window_index = 0;
+    }
+
+    uint8_t i = 0;
+    while (sorted[i] != oldest) {
+        i++;
+    }
+
+    if (block_sum > oldest) {
+        while (i + 1 < BASELINE_WINDOW && sorted[i + 1] < block_sum) {
+            sorted[i] = sorted[i + 1];
+            i++;
+        }
+    } else {
+        while (i > 0 && sorted[i - 1] > block_sum) {
+            sorted[i] = sorted[i - 1];
+            i--;
+        }
+    }
+    sorted[i] = block_sum;
+}
+
+/* End of file -------------------------------------------------------- */
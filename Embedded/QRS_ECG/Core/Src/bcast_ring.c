@@ -0,0 +1,218 @@
+/**
+ * @file       bcast_ring.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of single writer, multi reader broadcast ring.
+ *
+ * @note       Readers never write the head and the writer never writes a
+ *             cursor, so each index keeps a single owner.
+ * @example    bcast_ring.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "bcast_ring.h"
+
+/* Private macros ----------------------------------------------------- */
+/**
+ * @brief  Non-zero when x is a power of two greater than 1.
+ */
+#define BCAST_IS_POW2(x) ((x) > 1 && ((x) & ((x) - 1)) == 0)
+
+/**
+ * @brief  Compiler barrier. Keeps the data copy ahead of the index store
+ *         that publishes it to the other side.
+ */
+#define BCAST_BARRIER() __asm volatile("" ::: "memory")
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Lag of the slowest attached reader.
+ *
+ * @param[in]  ring  Pointer to a bcast_ring_t structure.
+ * @param[in]  head  Current write index.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Largest (head - cursor) over attached readers, 0 when none
+ */
+static uint32_t bcast_max_lag(const bcast_ring_t *ring, uint32_t head);
+
+/* Function definitions ----------------------------------------------- */
+uint32_t bcast_init(bcast_ring_t *ring, void *buf, uint32_t count, uint32_t elem_size, cb_policy_t policy)
+{
+    if (ring == NULL || buf == NULL || !BCAST_IS_POW2(count) || elem_size == 0)
+        return BCAST_ERROR;
+
+    ring->data = buf;
+    ring->count = count;
+    ring->mask = count - 1;
+    ring->elem_size = elem_size;
+    ring->policy = policy;
+    ring->head = 0;
+    ring->refused = 0;
+    for (uint32_t i = 0; i < BCAST_MAX_READERS; i++)
+    {
+        ring->readers[i].cursor = 0;
+        ring->readers[i].lost = 0;
+        ring->readers[i].overruns = 0;
+        ring->readers[i].attached = 0;
+    }
+
+    return BCAST_SUCCESS;
+}
+
+uint32_t bcast_attach(bcast_ring_t *ring)
+{
+    if (ring == NULL)
+        return BCAST_ERROR;
+
+    for (uint32_t i = 0; i < BCAST_MAX_READERS; i++)
+    {
+        bcast_reader_t *reader = &ring->readers[i];
+        if (reader->attached)
+            continue;
+
+        reader->cursor = ring->head;
+        reader->lost = 0;
+        reader->overruns = 0;
+        BCAST_BARRIER();
+        reader->attached = 1;
+        return i;
+    }
+
+    return BCAST_ERROR;
+}
+
+uint32_t bcast_detach(bcast_ring_t *ring, uint32_t id)
+{
+    if (ring == NULL || id >= BCAST_MAX_READERS || !ring->readers[id].attached)
+        return BCAST_ERROR;
+
+    ring->readers[id].attached = 0;
+    return BCAST_SUCCESS;
+}
+
+uint32_t bcast_write(bcast_ring_t *ring, const void *items, uint32_t n)
+{
+    uint32_t head = 0;
+    uint32_t space = 0;
+    uint32_t pos = 0;
+    uint32_t first = 0;
+    uint32_t accepted = 0;
+    const uint8_t *src = items;
+    if (ring == NULL || items == NULL)
+        return BCAST_ERROR;
+
+    head = ring->head;
+    if (ring->policy == CB_POLICY_DROP_NEW)
+    {
+        /* Writer-side check against the slowest cursor */
+        space = ring->count - bcast_max_lag(ring, head);
+        if (n > space)
+        {
+            ring->refused += n - space;
+            n = space;
+        }
+        accepted = n;
+    }
+    else
+    {
+        /* Everything is accepted, only the newest count elements survive */
+        accepted = n;
+        if (n > ring->count)
+        {
+            src += (n - ring->count) * ring->elem_size;
+            head += n - ring->count;
+            n = ring->count;
+        }
+    }
+
+    pos = head & ring->mask;
+    first = ring->count - pos;
+    if (first > n)
+        first = n;
+
+    memcpy(ring->data + pos * ring->elem_size, src, first * ring->elem_size);
+    if (n > first)
+        memcpy(ring->data, src + first * ring->elem_size, (n - first) * ring->elem_size);
+
+    BCAST_BARRIER();
+    ring->head = head + n;
+    return accepted;
+}
+
+uint32_t bcast_read(bcast_ring_t *ring, uint32_t id, void *items, uint32_t n)
+{
+    bcast_reader_t *reader = NULL;
+    uint32_t cursor = 0;
+    uint32_t lag = 0;
+    uint32_t pos = 0;
+    uint32_t first = 0;
+    uint32_t count = 0;
+    uint8_t *dst = items;
+    if (ring == NULL || items == NULL || id >= BCAST_MAX_READERS || !ring->readers[id].attached)
+        return BCAST_ERROR;
+
+    reader = &ring->readers[id];
+    do
+    {
+        /* Skip whatever the writer has already overwritten */
+        cursor = reader->cursor;
+        lag = ring->head - cursor;
+        if (lag > ring->count)
+        {
+            reader->lost += lag - ring->count;
+            reader->overruns++;
+            cursor += lag - ring->count;
+            reader->cursor = cursor;
+            lag = ring->count;
+        }
+
+        count = (n > lag) ? lag : n;
+        pos = cursor & ring->mask;
+        first = ring->count - pos;
+        if (first > count)
+            first = count;
+
+        memcpy(dst, ring->data + pos * ring->elem_size, first * ring->elem_size);
+        if (count > first)
+            memcpy(dst + first * ring->elem_size, ring->data, (count - first) * ring->elem_size);
+
+        BCAST_BARRIER();
+    } while (ring->head - cursor > ring->count);
+
+    reader->cursor = cursor + count;
+    return count;
+}
+
+uint32_t bcast_lag(bcast_ring_t *ring, uint32_t id)
+{
+    if (ring == NULL || id >= BCAST_MAX_READERS || !ring->readers[id].attached)
+        return BCAST_ERROR;
+
+    return ring->head - ring->readers[id].cursor;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint32_t bcast_max_lag(const bcast_ring_t *ring, uint32_t head)
+{
+    uint32_t max_lag = 0;
+    for (uint32_t i = 0; i < BCAST_MAX_READERS; i++)
+    {
+        if (!ring->readers[i].attached)
+            continue;
+
+        uint32_t lag = head - ring->readers[i].cursor;
+        if (lag > max_lag)
+            max_lag = lag;
+    }
+
+    return max_lag;
+}
+
+/* End of file -------------------------------------------------------- */
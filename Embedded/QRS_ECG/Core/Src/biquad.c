@@ -0,0 +1,166 @@
+/**
+ * @file       biquad.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of the fixed-point biquad cascade.
+ *
+ * @note       The block functions keep one stage's delay line in locals and
+ *             run the whole block through it before moving to the next
+ *             stage, so coefficients and state stay in registers.
+ * @example    biquad.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "biquad.h"
+
+/* Private defines ---------------------------------------------------- */
+/* None */
+
+/* Private enumerate/structure ---------------------------------------- */
+/* None */
+
+/* Private macros ----------------------------------------------------- */
+/**
+ * @brief  Clamp a 64-bit value to a signed integer range.
+ */
+#define BIQUAD_SAT(x, lo, hi) ((x) > (hi) ? (hi) : ((x) < (lo) ? (lo) : (x)))
+
+/* Public variables --------------------------------------------------- */
+/* None */
+
+/* Private variables -------------------------------------------------- */
+/* None */
+
+/* Private function prototypes ---------------------------------------- */
+/* None */
+
+/* Function definitions ----------------------------------------------- */
+void BiquadQ31_Init(BiquadQ31* biquad, const int32_t* coeffs, BiquadStateQ31* state, uint8_t num_stages, uint8_t shift)
+{
+    biquad->coeffs = coeffs;
+    biquad->state = state;
+    biquad->num_stages = num_stages;
+    biquad->shift = shift;
+    for (uint8_t i = 0; i < num_stages; i++) {
+        state[i].x1 = 0;
+        state[i].x2 = 0;
+        state[i].y1 = 0;
+        state[i].y2 = 0;
+    }
+}
+
+int32_t BiquadQ31_Apply(BiquadQ31* biquad, int32_t x)
+{
+    BiquadQ31_ApplyBlock(biquad, &x, &x, 1);
+    return x;
+}
+
+void BiquadQ31_ApplyBlock(BiquadQ31* biquad, const int32_t* in, int32_t* out, size_t n)
+{
+    const int32_t* c = biquad->coeffs;
+    const uint32_t frac = 31 - biquad->shift;
+    const int64_t round = (int64_t)1 << (frac - 1);
+
+    for (uint8_t s = 0; s < biquad->num_stages; s++, c += BIQUAD_COEFFS_PER_STAGE) {
+        BiquadStateQ31* st = &biquad->state[s];
+        int32_t x1 = st->x1, x2 = st->x2, y1 = st->y1, y2 = st->y2;
+        const int32_t* src = (s == 0) ? in : out;
+
+        for (size_t i = 0; i < n; i++) {
+            int32_t x = src[i];
+            int64_t acc = round;
+            acc += (int64_t)c[0] * x;
+            acc += (int64_t)c[1] * x1;
+            acc += (int64_t)c[2] * x2;
+            acc += (int64_t)c[3] * y1;
+            acc += (int64_t)c[4] * y2;
+            acc >>= frac;
+
+            int32_t y = (int32_t)BIQUAD_SAT(acc, INT32_MIN, INT32_MAX);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            out[i] = y;
+        }
+
+        st->x1 = x1;
+        st->x2 = x2;
+        st->y1 = y1;
+        st->y2 = y2;
+    }
+}
+
+void BiquadQ15_Init(BiquadQ15* biquad, const int16_t* coeffs, BiquadStateQ15* state, uint8_t num_stages, uint8_t shift)
+{
+    biquad->coeffs = coeffs;
+    biquad->state = state;
+    biquad->num_stages = num_stages;
+    biquad->shift = shift;
+    for (uint8_t i = 0; i < num_stages; i++) {
+        state[i].x1 = 0;
+        state[i].x2 = 0;
+        state[i].y1 = 0;
+        state[i].y2 = 0;
+        state[i].err = 0;
+    }
+}
+
+int16_t BiquadQ15_Apply(BiquadQ15* biquad, int16_t x)
+{
+    BiquadQ15_ApplyBlock(biquad, &x, &x, 1);
+    return x;
+}
+
+void BiquadQ15_ApplyBlock(BiquadQ15* biquad, const int16_t* in, int16_t* out, size_t n)
+{
+    const int16_t* c = biquad->coeffs;
+    const uint32_t frac = 15 - biquad->shift;
+    const int64_t mask = ((int64_t)1 << frac) - 1;
+
+    for (uint8_t s = 0; s < biquad->num_stages; s++, c += BIQUAD_COEFFS_PER_STAGE) {
+        BiquadStateQ15* st = &biquad->state[s];
+        int32_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        int16_t x1 = st->x1, x2 = st->x2, y1 = st->y1, y2 = st->y2;
+        int64_t err = st->err;
+        const int16_t* src = (s == 0) ? in : out;
+
+        for (size_t i = 0; i < n; i++) {
+            int16_t x = src[i];
+            // Products are at most 2^30, five of them only fit in 64 bits
+            int64_t acc = err;
+            acc += b0 * x;
+            acc += b1 * x1;
+            acc += b2 * x2;
+            acc += a1 * y1;
+            acc += a2 * y2;
+
+            // Carry the truncated fraction into the next sample (first-order
+            // error feedback), otherwise poles near DC amplify the rounding
+            err = acc & mask;
+            acc >>= frac;
+
+            int16_t y = (int16_t)BIQUAD_SAT(acc, INT16_MIN, INT16_MAX);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            out[i] = y;
+        }
+
+        st->x1 = x1;
+        st->x2 = x2;
+        st->y1 = y1;
+        st->y2 = y2;
+        st->err = (int16_t)err;
+    }
+}
+
+/* Private definitions ----------------------------------------------- */
+/* None */
+
+/* End of file -------------------------------------------------------- */
@@ -2,15 +2,17 @@
  * @file       cbuffer.c
  * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
  * @license    This project is released under the VB's License.
- * @version    1.0.0
- * @date       2025-04-10
+ * @version    1.1.0
+ * @date       2026-10-17
  * @author     Binh Nguyen
  *
  * @brief      Implementation of Circular Buffer for STM32.
  *             This Circular Buffer is safe to use in IRQ with single reader,
- *             single writer. No need to disable any IRQ.
+ *             single writer on a single core. No need to disable any IRQ.
+ *             For multicore hosts use spsc_ring.h.
  *
- * @note       Capacity = size - 1. Should use correct size of buffer when init.
+ * @note       Power-of-two size: free-running indices, capacity = size.
+ *             Other sizes: indices wrap at size, capacity = size - 1.
  * @example    main.c
  *             Main application using Circular Buffer to store ADC data.
  */
@@ -18,46 +20,151 @@
 /* Includes ----------------------------------------------------------- */
 #include "cbuffer.h"
 
+/* Private macros ----------------------------------------------------- */
+/**
+ * @brief  Non-zero when x is a power of two greater than 1.
+ */
+#define CB_IS_POW2(x) ((x) > 1 && ((x) & ((x) - 1)) == 0)
+
+/**
+ * @brief  Compiler barrier. Keeps the data copy ahead of the index store
+ *         that publishes it to the other side.
+ */
+#define CB_BARRIER() __asm volatile("" ::: "memory")
+
 /* Private function prototypes ---------------------------------------- */
 /**
- * @brief  Write 1 byte to circular buffer.
+ * @brief  Copy data into circular buffer starting at a given position.
+ *
+ * @param[inout]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]     pos     Index to start writing.
+ * @param[in]     src     Pointer to source data.
+ * @param[in]     nbytes  Size of data to copy, must fit in free space.
+ *
+ * @attention  Internal function, not for direct use. Splits the transfer
+ *             into at most two memcpy segments, does not move any index.
+ *
+ * @return
+ *  - None
+ */
+static void cb_copy_in(cbuffer_t *cb, uint32_t pos, const uint8_t *src, uint32_t nbytes);
+
+/**
+ * @brief  Copy data out of circular buffer starting at a given position.
+ *
+ * @param[in]   cb      Pointer to a cbuffer_t structure.
+ * @param[in]   pos     Index to start reading.
+ * @param[out]  dst     Pointer to destination buffer.
+ * @param[in]   nbytes  Size of data to copy, must fit in stored data.
+ *
+ * @attention  Internal function, not for direct use. Splits the transfer
+ *             into at most two memcpy segments, does not move any index.
+ *
+ * @return
+ *  - None
+ */
+static void cb_copy_out(const cbuffer_t *cb, uint32_t pos, uint8_t *dst, uint32_t nbytes);
+
+/**
+ * @brief  Round a byte count down to a whole number of elements.
  *
- * @param[inout]  cb    Pointer to a cbuffer_t structure.
- * @param[in]     byte  Data to write.
+ * @param[in]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]  nbytes  Number of bytes.
  *
  * @attention  Internal function, not for direct use.
  *
  * @return
- *  - (0) : Success
- *  - (-1): Error
+ *  - Largest multiple of elem_size not above nbytes
  */
-static uint32_t cb_write_byte(cbuffer_t *cb, uint8_t byte);
+static uint32_t cb_round_elem(const cbuffer_t *cb, uint32_t nbytes);
 
 /**
- * @brief  Read 1 byte from circular buffer.
+ * @brief  Convert a reader/writer index to a position in the data array.
  *
- * @param[in]   cb    Pointer to a cbuffer_t structure.
- * @param[out]  byte  Pointer to data buffer.
+ * @param[in]  cb   Pointer to a cbuffer_t structure.
+ * @param[in]  pos  Reader or writer index.
  *
  * @attention  Internal function, not for direct use.
  *
  * @return
- *  - (0) : Success
- *  - (-1): Error
+ *  - Position in the data array
+ */
+static uint32_t cb_offset(const cbuffer_t *cb, uint32_t pos);
+
+/**
+ * @brief  Advance a reader/writer index by a number of bytes.
+ *
+ * @param[in]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]  pos     Current index.
+ * @param[in]  nbytes  Number of bytes to advance (<= size).
+ *
+ * @attention  Internal function, not for direct use. Free-running indices
+ *             are only incremented, modulo indices wrap at size.
+ *
+ * @return
+ *  - New index
  */
-static uint32_t cb_read_byte(cbuffer_t *cb, uint8_t *byte);
+static uint32_t cb_advance(const cbuffer_t *cb, uint32_t pos, uint32_t nbytes);
+
+/**
+ * @brief  Skip data the writer has overwritten. Reader side only.
+ *
+ * @param[inout]  cb  Pointer to a cbuffer_t structure.
+ *
+ * @attention  Internal function, not for direct use. Only does work with
+ *             CB_POLICY_OVERWRITE, where the skipped bytes are added to
+ *             dropped.
+ *
+ * @return
+ *  - Reader index after the skip
+ */
+static uint32_t cb_resync(cbuffer_t *cb);
+
+/**
+ * @brief  Update overflow and high-water accounting after a write and fire
+ *         the watermark callback on an upward crossing. Writer side only.
+ *
+ * @param[inout]  cb      Pointer to a cbuffer_t structure.
+ * @param[in]     nbytes  Number of bytes the write added.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void cb_track_write(cbuffer_t *cb, uint32_t nbytes);
 
 /* Function definitions ----------------------------------------------- */
-uint32_t cb_init(cbuffer_t *cb, void *buf, uint32_t size)
+uint32_t cb_init(cbuffer_t *cb, void *buf, uint32_t size, cb_policy_t policy)
+{
+    return cb_init_elem(cb, buf, size, 1, policy);
+}
+
+uint32_t cb_init_elem(cbuffer_t *cb, void *buf, uint32_t size, uint32_t elem_size, cb_policy_t policy)
 {
-    if (cb == NULL || buf == NULL || size >= CB_MAX_SIZE)
+    if (cb == NULL || buf == NULL || size > CB_MAX_SIZE)
+        return CB_ERROR;
+
+    if (elem_size == 0 || size % elem_size != 0)
+        return CB_ERROR;
+
+    if (policy == CB_POLICY_OVERWRITE && !CB_IS_POW2(size))
         return CB_ERROR;
 
     cb->data = buf;
     cb->size = size;
+    cb->mask = CB_IS_POW2(size) ? size - 1 : 0;
+    cb->elem_size = elem_size;
+    cb->policy = policy;
     cb->writer = 0;
     cb->reader = 0;
     cb->overflow = 0;
+    cb->dropped = 0;
+    cb->overflow_events = 0;
+    cb->high_water = 0;
+    cb->watermark = 0;
+    cb->watermark_cb = NULL;
+    cb->watermark_arg = NULL;
     cb->active = 1;
 
     return CB_SUCCESS;
@@ -77,50 +184,67 @@ uint32_t cb_clear(cbuffer_t *cb)
 
 uint32_t cb_read(cbuffer_t *cb, void *buf, uint32_t nbytes)
 {
-    int data_count = 0;
-    int num_avail_bytes = 0;
+    uint32_t data_count = 0;
+    uint32_t reader = 0;
+    uint32_t count = 0;
     if (cb == NULL || buf == NULL || !cb->active)
         return CB_ERROR;
 
-    cb->active = 0;
-    data_count = cb_data_count(cb);
-    if (data_count >= nbytes)
-        num_avail_bytes = nbytes;
-    else
-        num_avail_bytes = data_count;
+    /* Retry if the writer overwrote the region while it was copied */
+    do
+    {
+        reader = cb_resync(cb);
+        data_count = cb_data_count(cb);
+        count = (nbytes > data_count) ? data_count : nbytes;
+        count = cb_round_elem(cb, count);
 
-    for (int i = 0; i < num_avail_bytes; i++)
-        cb_read_byte(cb, (uint8_t *)buf + i);
+        cb_copy_out(cb, reader, (uint8_t *)buf, count);
+        CB_BARRIER();
+    } while (cb->policy == CB_POLICY_OVERWRITE && cb->writer - reader > cb->size);
 
-    cb->active = 1;
-    return num_avail_bytes;
+    cb->reader = cb_advance(cb, reader, count);
+
+    return count;
 }
 
 uint32_t cb_write(cbuffer_t *cb, void *buf, uint32_t nbytes)
 {
-    int space_count = 0;
-    int num_avail_bytes = 0;
+    uint32_t space_count = 0;
+    uint32_t writer = 0;
+    uint32_t skip = 0;
     if (cb == NULL || buf == NULL || !cb->active)
         return CB_ERROR;
 
-    cb->active = 0;
-    space_count = cb_space_count(cb);
-    if (space_count >= nbytes)
+    nbytes = cb_round_elem(cb, nbytes);
+    if (cb->policy == CB_POLICY_OVERWRITE)
     {
-        num_avail_bytes = nbytes;
-        cb->overflow = 0;
+        /* Only the newest size bytes can survive a larger write */
+        if (nbytes > cb->size)
+            skip = nbytes - cb->size;
     }
     else
     {
-        num_avail_bytes = space_count;
-        cb->overflow = nbytes - space_count;
+        space_count = cb_round_elem(cb, cb_space_count(cb));
+        if (space_count >= nbytes)
+        {
+            cb->overflow = 0;
+        }
+        else
+        {
+            cb->overflow = nbytes - space_count;
+            cb->dropped += cb->overflow;
+            cb->overflow_events++;
+            nbytes = space_count;
+        }
     }
 
-    for (int i = 0; i < num_avail_bytes; i++)
-        cb_write_byte(cb, *((uint8_t *)buf + i));
+    writer = cb->writer;
+    cb_copy_in(cb, writer + skip, (const uint8_t *)buf + skip, nbytes - skip);
+    CB_BARRIER();
+    cb->writer = cb_advance(cb, writer, nbytes);
+    cb_track_write(cb, nbytes);
 
-    cb->active = 1;
-    return num_avail_bytes;
+    return nbytes;
 }
 
 uint32_t cb_data_count(cbuffer_t *cb)
@@ -129,6 +253,15 @@ uint32_t cb_data_count(cbuffer_t *cb)
     if (cb == NULL)
         return CB_ERROR;
 
+    if (cb->mask)
+    {
+        res = cb->writer - cb->reader;
+        if ((uint32_t)res > cb->size)
+            res = cb->size;
+
+        return res;
+    }
+
     if (cb->writer >= cb->reader)
         res = cb->writer - cb->reader;
     else
@@ -143,6 +276,9 @@ uint32_t cb_space_count(cbuffer_t *cb)
     if (cb == NULL)
         return CB_ERROR;
 
+    if (cb->mask)
+        return cb->size - cb_data_count(cb);
+
     if (cb->reader > cb->writer)
         res = cb->reader - cb->writer - 1;
     else if (cb->reader < cb->writer)
@@ -153,33 +289,221 @@ uint32_t cb_space_count(cbuffer_t *cb)
     return res;
 }
 
-/* Private definitions ----------------------------------------------- */
-static uint32_t cb_write_byte(cbuffer_t *cb, uint8_t byte)
+uint32_t cb_peek_contiguous(cbuffer_t *cb, void **ptr)
 {
-    uint32_t next = cb->writer + 1;
-    if (next == cb->size)
-        next = 0;
+    uint32_t data_count = 0;
+    uint32_t pos = 0;
+    if (cb == NULL || ptr == NULL || !cb->active)
+        return CB_ERROR;
 
-    if (next == cb->reader)
+    pos = cb_offset(cb, cb_resync(cb));
+    data_count = cb_data_count(cb);
+    if (data_count > cb->size - pos)
+        data_count = cb->size - pos;
+
+    *ptr = cb->data + pos;
+    return cb_round_elem(cb, data_count);
+}
+
+uint32_t cb_consume(cbuffer_t *cb, uint32_t nbytes)
+{
+    if (cb == NULL || !cb->active || nbytes > cb_data_count(cb))
+        return CB_ERROR;
+
+    if (cb_round_elem(cb, nbytes) != nbytes)
         return CB_ERROR;
 
-    *(cb->data + cb->writer) = byte;
-    cb->writer = next;
+    /* Peeked data may have been overwritten while in use */
+    if (cb->policy == CB_POLICY_OVERWRITE && cb->writer - cb->reader > cb->size)
+    {
+        cb_resync(cb);
+        return CB_ERROR;
+    }
+
+    CB_BARRIER();
+    cb->reader = cb_advance(cb, cb->reader, nbytes);
     return CB_SUCCESS;
 }
 
-static uint32_t cb_read_byte(cbuffer_t *cb, uint8_t *byte)
+uint32_t cb_reserve(cbuffer_t *cb, void **ptr)
+{
+    uint32_t space_count = 0;
+    uint32_t pos = 0;
+    if (cb == NULL || ptr == NULL || !cb->active)
+        return CB_ERROR;
+
+    if (cb->policy == CB_POLICY_OVERWRITE)
+        space_count = cb->size;
+    else
+        space_count = cb_space_count(cb);
+
+    pos = cb_offset(cb, cb->writer);
+    if (space_count > cb->size - pos)
+        space_count = cb->size - pos;
+
+    *ptr = cb->data + pos;
+    return cb_round_elem(cb, space_count);
+}
+
+uint32_t cb_commit(cbuffer_t *cb, uint32_t nbytes)
 {
-    uint32_t next = cb->reader + 1;
-    if (cb->reader == cb->writer)
+    if (cb == NULL || !cb->active)
         return CB_ERROR;
 
-    if (next == cb->size)
-        next = 0;
+    if (cb->policy != CB_POLICY_OVERWRITE && nbytes > cb_space_count(cb))
+        return CB_ERROR;
+
+    if (nbytes > cb->size || cb_round_elem(cb, nbytes) != nbytes)
+        return CB_ERROR;
 
-    *byte = *(cb->data + cb->reader);
-    cb->reader = next;
+    CB_BARRIER();
+    cb->writer = cb_advance(cb, cb->writer, nbytes);
+    cb_track_write(cb, nbytes);
     return CB_SUCCESS;
 }
 
+uint32_t cb_get_stats(cbuffer_t *cb, cb_stats_t *stats)
+{
+    uint32_t lag = 0;
+    if (cb == NULL || stats == NULL)
+        return CB_ERROR;
+
+    stats->dropped = cb->dropped;
+    if (cb->policy == CB_POLICY_OVERWRITE)
+    {
+        /* Data already overwritten but not yet skipped by the reader */
+        lag = cb->writer - cb->reader;
+        if (lag > cb->size)
+            stats->dropped += lag - cb->size;
+    }
+
+    stats->dropped /= cb->elem_size;
+    stats->overflow_events = cb->overflow_events;
+    stats->high_water = cb->high_water / cb->elem_size;
+
+    return CB_SUCCESS;
+}
+
+uint32_t cb_set_watermark(cbuffer_t *cb, uint32_t level, cb_watermark_cb_t callback, void *arg)
+{
+    if (cb == NULL || level == 0 || level > cb->size)
+        return CB_ERROR;
+
+    /* Disarm first so the writer never sees a half-updated registration */
+    cb->watermark_cb = NULL;
+    CB_BARRIER();
+    cb->watermark = level;
+    cb->watermark_arg = arg;
+    CB_BARRIER();
+    cb->watermark_cb = callback;
+
+    return CB_SUCCESS;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void cb_copy_in(cbuffer_t *cb, uint32_t pos, const uint8_t *src, uint32_t nbytes)
+{
+    uint32_t first = 0;
+    pos = cb_offset(cb, pos);
+    first = cb->size - pos;
+    if (first > nbytes)
+        first = nbytes;
+
+    memcpy(cb->data + pos, src, first);
+    if (nbytes > first)
+        memcpy(cb->data, src + first, nbytes - first);
+}
+
+static void cb_copy_out(const cbuffer_t *cb, uint32_t pos, uint8_t *dst, uint32_t nbytes)
+{
+    uint32_t first = 0;
+    pos = cb_offset(cb, pos);
+    first = cb->size - pos;
+    if (first > nbytes)
+        first = nbytes;
+
+    memcpy(dst, cb->data + pos, first);
+    if (nbytes > first)
+        memcpy(dst + first, cb->data, nbytes - first);
+}
+
+static uint32_t cb_round_elem(const cbuffer_t *cb, uint32_t nbytes)
+{
+    if (cb->elem_size == 1)
+        return nbytes;
+
+    return nbytes - nbytes % cb->elem_size;
+}
+
+static uint32_t cb_offset(const cbuffer_t *cb, uint32_t pos)
+{
+    if (cb->mask)
+        return pos & cb->mask;
+
+    return pos;
+}
+
+static uint32_t cb_advance(const cbuffer_t *cb, uint32_t pos, uint32_t nbytes)
+{
+    pos += nbytes;
+    if (cb->mask)
+        return pos;
+
+    if (pos >= cb->size)
+        pos -= cb->size;
+
+    return pos;
+}
+
+static uint32_t cb_resync(cbuffer_t *cb)
+{
+    uint32_t reader = cb->reader;
+    uint32_t lag = 0;
+    if (cb->policy != CB_POLICY_OVERWRITE)
+        return reader;
+
+    lag = cb->writer - reader;
+    if (lag > cb->size)
+    {
+        cb->dropped += lag - cb->size;
+        reader += lag - cb->size;
+        cb->reader = reader;
+    }
+
+    return reader;
+}
+
+static void cb_track_write(cbuffer_t *cb, uint32_t nbytes)
+{
+    uint32_t level = 0;
+    uint32_t before = 0;
+    if (cb->policy == CB_POLICY_OVERWRITE)
+    {
+        level = cb->writer - cb->reader;
+        before = level - nbytes;
+        if (level > cb->size)
+        {
+            cb->overflow = level - cb->size;
+            cb->overflow_events++;
+            level = cb->size;
+        }
+        else
+        {
+            cb->overflow = 0;
+        }
+    }
+    else
+    {
+        level = cb_data_count(cb);
+        before = level - nbytes;
+    }
+
+    if (level > cb->high_water)
+        cb->high_water = level;
+
+    /* The reader cannot run inside this call, so before is exact */
+    if (level >= cb->watermark && before < cb->watermark && cb->watermark_cb != NULL)
+        cb->watermark_cb(cb->watermark_arg);
+}
+
 /* End of file -------------------------------------------------------- */
@@ -2,13 +2,15 @@
  * @file       filter.c
  * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
  * @license    This project is released under the VB's License.
- * @version    1.0.2
- * @date       2025-04-10
+ * @version    1.2.0
+ * @date       2026-10-17
  * @author     Binh Nguyen
  *
  * @brief      Implementation of signal filtering functions for STM32.
  *
  * @note       This file implements a Bandpass Filter for filtering ADC signals.
+ *             Both moving averages are circular windows with running sums,
+ *             so each sample costs O(1) whatever the window size.
  * @example    main.c
  *             Main application using the filter to filter ADC data.
  */
@@ -16,6 +18,7 @@
 /* Includes ----------------------------------------------------------- */
 #include "filter.h"
 #include "mylib.h"
+#include "trace.h"
 
 /* Private defines ---------------------------------------------------- */
 /* None */
@@ -24,7 +27,38 @@
 /* None */
 
 /* Private macros ----------------------------------------------------- */
-/* None */
+/**
+ * @brief  Packed-halfword operations. CMSIS intrinsics on cores with the DSP
+ *         extension, plain C with the same results everywhere else.
+ */
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define FILTER_SSUB16(a, b)   __SSUB16((a), (b))
+#define FILTER_SMUAD(a, b)    ((int32_t)__SMUAD((a), (b)))
+#define FILTER_SSAT16(x)      __SSAT((x), 16)
+#define FILTER_PKHBT(lo, hi)  __PKHBT((lo), (hi), 16)
+#else
+#define FILTER_SSUB16(a, b)   Filter_Ssub16((a), (b))
+#define FILTER_SMUAD(a, b)    Filter_Smuad((a), (b))
+#define FILTER_SSAT16(x)      Filter_Ssat16(x)
+#define FILTER_PKHBT(lo, hi)  (((uint32_t)(lo) & 0xFFFF) | ((uint32_t)(hi) << 16))
+#endif
+
+/**
+ * @brief  Low and high signed halfword of a packed pair.
+ */
+#define FILTER_LO16(x) ((int32_t)(int16_t)((x) & 0xFFFF))
+#define FILTER_HI16(x) ((int32_t)(int16_t)((x) >> 16))
+
+/**
+ * @brief  Filter bank leads in halfword pairs. Always on cores with the DSP
+ *         extension; define FILTER_BANK_PAIRED to run the same path on the
+ *         host with the portable operations.
+ */
+#if (defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)) || defined(FILTER_BANK_PAIRED)
+#define FILTER_BANK_USE_PAIRS 1
+#else
+#define FILTER_BANK_USE_PAIRS 0
+#endif
 
 /* Public variables --------------------------------------------------- */
 /* None */
@@ -33,7 +67,90 @@
 /* None */
 
 /* Private function prototypes ---------------------------------------- */
-/* None */
+/**
+ * @brief  Filter one sample, shared by the single-sample and block APIs.
+ *
+ * @param[inout]  filter      Pointer to the BandpassFilter structure.
+ * @param[in]     new_sample  New ADC sample to be filtered.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Filtered value (int32_t)
+ */
+static inline int32_t BandpassFilter_Step(BandpassFilter* filter, int32_t new_sample);
+
+/**
+ * @brief  Filter one sample with the packed-halfword state.
+ *
+ * @param[inout]  filter      Pointer to the BandpassFilterQ15 structure.
+ * @param[in]     new_sample  New sample, 12-bit range.
+ *
+ * @attention  Internal function, not for direct use. Used for the sample
+ *             that realigns the state to an even index.
+ *
+ * @return
+ *  - Filtered value (int16_t)
+ */
+static inline int16_t BandpassFilterQ15_Step(BandpassFilterQ15* filter, int16_t new_sample);
+
+/**
+ * @brief  Load two adjacent halfwords as one packed word (low = first).
+ *
+ * @param[in]  p  Pointer to the first halfword, 2-byte aligned.
+ *
+ * @attention  Internal function, not for direct use. Cortex-M4 handles the
+ *             unaligned LDR this compiles to.
+ *
+ * @return
+ *  - Packed pair
+ */
+static inline uint32_t Filter_LoadPair(const int16_t* p);
+
+/**
+ * @brief  Store a packed word as two adjacent halfwords.
+ *
+ * @param[out]  p     Pointer to the first halfword, 2-byte aligned.
+ * @param[in]   pair  Packed pair, low halfword first.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static inline void Filter_StorePair(int16_t* p, uint32_t pair);
+
+#if !(defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+/**
+ * @brief  Portable SSUB16: per-halfword a - b, wrapping.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Packed differences
+ */
+static inline uint32_t Filter_Ssub16(uint32_t a, uint32_t b);
+
+/**
+ * @brief  Portable SMUAD: lo(a) * lo(b) + hi(a) * hi(b).
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Sum of products
+ */
+static inline int32_t Filter_Smuad(uint32_t a, uint32_t b);
+
+/**
+ * @brief  Portable SSAT to 16 bits.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - x clamped to -32768..32767
+ */
+static inline int32_t Filter_Ssat16(int32_t x);
+#endif
 
 /* Function definitions ----------------------------------------------- */
 void BandpassFilter_Init(BandpassFilter* filter)
@@ -44,36 +161,172 @@ void BandpassFilter_Init(BandpassFilter* filter)
     for (uint16_t i = 0; i < BANDPASS_HIGHPASS_WINDOW_SIZE; i++) {
         filter->highpass_buffer[i] = 0;
     }
+    filter->lowpass_sum = 0;
+    filter->highpass_sum = 0;
     filter->lowpass_index = 0;
     filter->highpass_index = 0;
 }
 
 int32_t BandpassFilter_Apply(BandpassFilter* filter, int32_t new_sample)
 {
-    // Low-pass filter (cutoff ~40 Hz at 200 Hz)
-    for (uint8_t i = BANDPASS_LOWPASS_WINDOW_SIZE - 1; i > 0; i--) {
-        filter->lowpass_buffer[i] = filter->lowpass_buffer[i - 1];
+    int32_t highpass = BandpassFilter_Step(filter, new_sample);
+
+    // Debug: Trace filtered value once per high-pass window, sent later from the main loop
+    if (filter->highpass_index == 0) {
+        trace_log(&trace_irq, TRACE_EV_FILTER, 0, highpass, 0);
     }
-    filter->lowpass_buffer[0] = new_sample;
 
-    int32_t lowpass = 0;
-    for (uint8_t i = 0; i < BANDPASS_LOWPASS_WINDOW_SIZE; i++) {
-        lowpass += filter->lowpass_buffer[i];
+    return highpass;
+}
+
+void BandpassFilter_ApplyBlock(BandpassFilter* filter, const int32_t* in, int32_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = BandpassFilter_Step(filter, in[i]);
     }
-    lowpass = (lowpass * 384) >> 10;
+}
 
-    // High-pass filter (cutoff ~0.5 Hz at 200 Hz)
-    for (uint16_t i = BANDPASS_HIGHPASS_WINDOW_SIZE - 1; i > 0; i--) {
-        filter->highpass_buffer[i] = filter->highpass_buffer[i - 1];
+void BandpassFilterQ15_Init(BandpassFilterQ15* filter)
+{
+    memset(filter, 0, sizeof(*filter));
+}
+
+void BandpassFilterQ15_ApplyBlock(BandpassFilterQ15* filter, const int16_t* in, int16_t* out, size_t n)
+{
+    size_t i = 0;
+
+    // Pairs start on an even index so the high-pass pair never wraps
+    if (n > 0 && (filter->index & 1)) {
+        out[i] = BandpassFilterQ15_Step(filter, in[i]);
+        i++;
     }
-    filter->highpass_buffer[0] = lowpass;
 
-    int32_t lowpass_average = 0;
-    for (uint16_t i = 0; i < BANDPASS_HIGHPASS_WINDOW_SIZE; i++) {
-        lowpass_average += filter->highpass_buffer[i];
+    int32_t lowpass_sum = filter->lowpass_sum;
+    int32_t highpass_sum = filter->highpass_sum;
+    uint16_t index = filter->index;
+
+    for (; i + 1 < n; i += 2) {
+        uint32_t h = index & (BANDPASS_Q15_HISTORY_SIZE - 1);
+        uint32_t oldest = (index - BANDPASS_LOWPASS_WINDOW_SIZE) & (BANDPASS_Q15_HISTORY_SIZE - 1);
+
+        // Low-pass: x[n] - x[n-5] for both samples, then prefix sums
+        uint32_t x = Filter_LoadPair(&in[i]);
+        uint32_t dx = FILTER_SSUB16(x, Filter_LoadPair(&filter->lowpass_history[oldest]));
+        Filter_StorePair(&filter->lowpass_history[h], x);
+        Filter_StorePair(&filter->lowpass_history[h + BANDPASS_Q15_HISTORY_SIZE], x);
+
+        int32_t lowpass_sum0 = lowpass_sum + FILTER_LO16(dx);
+        lowpass_sum += FILTER_SMUAD(dx, 0x00010001);
+        int32_t lowpass0 = (lowpass_sum0 * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+        int32_t lowpass1 = (lowpass_sum * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+
+        // High-pass: same pattern on the low-pass outputs
+        uint32_t lp = FILTER_PKHBT(lowpass0, lowpass1);
+        int16_t* slot = &filter->highpass_buffer[index & (BANDPASS_HIGHPASS_WINDOW_SIZE - 1)];
+        uint32_t dlp = FILTER_SSUB16(lp, Filter_LoadPair(slot));
+        Filter_StorePair(slot, lp);
+
+        int32_t highpass_sum0 = highpass_sum + FILTER_LO16(dlp);
+        highpass_sum += FILTER_SMUAD(dlp, 0x00010001);
+        int32_t y0 = FILTER_SSAT16(lowpass0 - (highpass_sum0 >> BANDPASS_HIGHPASS_SHIFT));
+        int32_t y1 = FILTER_SSAT16(lowpass1 - (highpass_sum >> BANDPASS_HIGHPASS_SHIFT));
+        Filter_StorePair(&out[i], FILTER_PKHBT(y0, y1));
+
+        index = (index + 2) & (BANDPASS_HIGHPASS_WINDOW_SIZE - 1);
+    }
+
+    filter->lowpass_sum = lowpass_sum;
+    filter->highpass_sum = highpass_sum;
+    filter->index = index;
+
+    if (i < n) {
+        out[i] = BandpassFilterQ15_Step(filter, in[i]);
+    }
+}
+
+uint32_t BandpassFilterBank_Init(BandpassFilterBank* bank, uint8_t num_leads)
+{
+    if (num_leads == 0 || num_leads > BANDPASS_BANK_MAX_LEADS) {
+        return BANDPASS_ERROR;
+    }
+
+    memset(bank, 0, sizeof(*bank));
+    bank->num_leads = num_leads;
+    return BANDPASS_SUCCESS;
+}
+
+void BandpassFilterBank_Step(BandpassFilterBank* bank, const int16_t* in, int16_t* out)
+{
+    uint32_t num_leads = bank->num_leads;
+    int16_t* lowpass_row = bank->lowpass_buffer[bank->lowpass_index];
+    int16_t* highpass_row = bank->highpass_buffer[bank->highpass_index];
+    uint32_t l = 0;
+
+#if FILTER_BANK_USE_PAIRS
+    // Two leads per word: one SSUB16 per window updates both running sums
+    for (; l + 1 < num_leads; l += 2) {
+        uint32_t x = Filter_LoadPair(&in[l]);
+        uint32_t dx = FILTER_SSUB16(x, Filter_LoadPair(&lowpass_row[l]));
+        Filter_StorePair(&lowpass_row[l], x);
+        int32_t lowpass0 = ((bank->lowpass_sum[l] += FILTER_LO16(dx)) * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+        int32_t lowpass1 = ((bank->lowpass_sum[l + 1] += FILTER_HI16(dx)) * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+
+        uint32_t lp = FILTER_PKHBT(lowpass0, lowpass1);
+        uint32_t dlp = FILTER_SSUB16(lp, Filter_LoadPair(&highpass_row[l]));
+        Filter_StorePair(&highpass_row[l], lp);
+        int32_t y0 = FILTER_SSAT16(lowpass0 - ((bank->highpass_sum[l] += FILTER_LO16(dlp)) >> BANDPASS_HIGHPASS_SHIFT));
+        int32_t y1 = FILTER_SSAT16(lowpass1 - ((bank->highpass_sum[l + 1] += FILTER_HI16(dlp)) >> BANDPASS_HIGHPASS_SHIFT));
+        Filter_StorePair(&out[l], FILTER_PKHBT(y0, y1));
+    }
+#endif
+
+    // Remaining leads (all of them without pairs), independent per lead
+    for (; l < num_leads; l++) {
+        int32_t x = in[l];
+        bank->lowpass_sum[l] += x - lowpass_row[l];
+        lowpass_row[l] = (int16_t)x;
+        int32_t lowpass = (bank->lowpass_sum[l] * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+
+        bank->highpass_sum[l] += lowpass - highpass_row[l];
+        highpass_row[l] = (int16_t)lowpass;
+        int32_t highpass = lowpass - (bank->highpass_sum[l] >> BANDPASS_HIGHPASS_SHIFT);
+
+        if (highpass > 32767) highpass = 32767;
+        if (highpass < -32768) highpass = -32768;
+        out[l] = (int16_t)highpass;
+    }
+
+    if (++bank->lowpass_index == BANDPASS_LOWPASS_WINDOW_SIZE) {
+        bank->lowpass_index = 0;
+    }
+    bank->highpass_index = (bank->highpass_index + 1) & (BANDPASS_HIGHPASS_WINDOW_SIZE - 1);
+}
+
+void BandpassFilterBank_ApplyBlock(BandpassFilterBank* bank, const int16_t* in, int16_t* out, size_t n)
+{
+    for (size_t t = 0; t < n; t++) {
+        BandpassFilterBank_Step(bank, &in[t * bank->num_leads], &out[t * bank->num_leads]);
+    }
+}
+
+/* Private definitions ----------------------------------------------- */
+static inline int32_t BandpassFilter_Step(BandpassFilter* filter, int32_t new_sample)
+{
+    // Low-pass filter (cutoff ~40 Hz at 200 Hz): replace the oldest sample in the running sum
+    filter->lowpass_sum += new_sample - filter->lowpass_buffer[filter->lowpass_index];
+    filter->lowpass_buffer[filter->lowpass_index] = new_sample;
+    if (++filter->lowpass_index == BANDPASS_LOWPASS_WINDOW_SIZE) {
+        filter->lowpass_index = 0;
     }
 
-    lowpass_average >>= 7;
+    int32_t lowpass = (filter->lowpass_sum * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+
+    // High-pass filter (cutoff ~0.5 Hz at 200 Hz)
+    filter->highpass_sum += lowpass - filter->highpass_buffer[filter->highpass_index];
+    filter->highpass_buffer[filter->highpass_index] = lowpass;
+    filter->highpass_index = (filter->highpass_index + 1) & (BANDPASS_HIGHPASS_WINDOW_SIZE - 1);
+
+    int32_t lowpass_average = filter->highpass_sum >> BANDPASS_HIGHPASS_SHIFT;
 
     // High-pass filter: y[n] = x[n] - (1/128) * sum(x[n-k])
     int32_t highpass = lowpass - lowpass_average;
@@ -82,17 +335,59 @@ int32_t BandpassFilter_Apply(BandpassFilter* filter, int32_t new_sample)
     if (highpass > 32767) highpass = 32767;
     if (highpass < -32768) highpass = -32768;
 
-    // Debug: Print filtered value every 100 samples
-    if (filter->highpass_index % 100 == 0) {
-        char debug_msg[50];
-        sprintf(debug_msg, "DEBUG:FILTER:%ld\n", highpass);
-        HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
-    }
-
     return highpass;
 }
 
-/* Private definitions ----------------------------------------------- */
-/* None */
+static inline int16_t BandpassFilterQ15_Step(BandpassFilterQ15* filter, int16_t new_sample)
+{
+    uint16_t index = filter->index;
+    uint32_t h = index & (BANDPASS_Q15_HISTORY_SIZE - 1);
+    uint32_t oldest = (index - BANDPASS_LOWPASS_WINDOW_SIZE) & (BANDPASS_Q15_HISTORY_SIZE - 1);
+
+    filter->lowpass_sum += new_sample - filter->lowpass_history[oldest];
+    filter->lowpass_history[h] = new_sample;
+    filter->lowpass_history[h + BANDPASS_Q15_HISTORY_SIZE] = new_sample;
+    int32_t lowpass = (filter->lowpass_sum * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+
+    int16_t* slot = &filter->highpass_buffer[index];
+    filter->highpass_sum += lowpass - *slot;
+    *slot = (int16_t)lowpass;
+    filter->index = (index + 1) & (BANDPASS_HIGHPASS_WINDOW_SIZE - 1);
+
+    return (int16_t)FILTER_SSAT16(lowpass - (filter->highpass_sum >> BANDPASS_HIGHPASS_SHIFT));
+}
+
+static inline uint32_t Filter_LoadPair(const int16_t* p)
+{
+    uint32_t pair;
+    memcpy(&pair, p, sizeof(pair));
+    return pair;
+}
+
+static inline void Filter_StorePair(int16_t* p, uint32_t pair)
+{
+    memcpy(p, &pair, sizeof(pair));
+}
+
+#if !(defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+static inline uint32_t Filter_Ssub16(uint32_t a, uint32_t b)
+{
+    uint32_t lo = (uint32_t)(FILTER_LO16(a) - FILTER_LO16(b)) & 0xFFFF;
+    uint32_t hi = (uint32_t)(FILTER_HI16(a) - FILTER_HI16(b)) & 0xFFFF;
+    return lo | (hi << 16);
+}
+
+static inline int32_t Filter_Smuad(uint32_t a, uint32_t b)
+{
+    return FILTER_LO16(a) * FILTER_LO16(b) + FILTER_HI16(a) * FILTER_HI16(b);
+}
+
+static inline int32_t Filter_Ssat16(int32_t x)
+{
+    if (x > 32767) return 32767;
+    if (x < -32768) return -32768;
+    return x;
+}
+#endif
 
 /* End of file -------------------------------------------------------- */
@@ -16,7 +16,10 @@
 #include "main.h"
 #include "mylib.h"
 #include "filter.h"
+#include "notch.h"
 #include "cbuffer.h"
+#include "adc_sample.h"
+#include "trace.h"
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
@@ -25,14 +28,17 @@
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
 BandpassFilter bandpass_filter;
+NotchFilter notch_filter;
 cbuffer_t adc_buffer;
-uint8_t adc_buffer_data[4096];
+adc_sample_t adc_buffer_data[ADC_SAMPLE_RING_SIZE];
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define START_BYTE 0xAA
 #define END_BYTE 0xBB
+#define TRACE_RECORDS_PER_FRAME 8
+#define MAINS_NOTCH NOTCH_MAINS_50HZ /* NOTCH_MAINS_60HZ on 60 Hz grids */
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -60,11 +66,43 @@ static void MX_ADC1_Init(void);
 static void MX_USART2_UART_Init(void);
 static void MX_TIM2_Init(void);
 /* USER CODE BEGIN PFP */
+static void Report_BufferStats(void);
+static void Frame_Ready(void *arg);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/**
+  * @brief  Send ADC buffer loss statistics when new losses occurred.
+  * @retval None
+  */
+static void Report_BufferStats(void)
+{
+  static uint32_t reported_events = 0;
+  cb_stats_t stats;
+  char msg[64];
+
+  cb_get_stats(&adc_buffer, &stats);
+  if (stats.overflow_events == reported_events)
+  {
+    return;
+  }
+  reported_events = stats.overflow_events;
+
+  sprintf(msg, "DEBUG:CB_STATS:%lu:%lu:%lu\n", stats.dropped, stats.overflow_events, stats.high_water);
+  HAL_UART_Transmit(&huart2, (uint8_t*)msg, strlen(msg), 200);
+}
+
+/**
+  * @brief  ADC buffer watermark callback, runs in TIM2 IRQ context.
+  * @param  arg Pointer to the flag to raise.
+  * @retval None
+  */
+static void Frame_Ready(void *arg)
+{
+  *(volatile uint8_t*)arg = 1;
+}
 
 /* USER CODE END 0 */
 
@@ -101,8 +139,12 @@ int main(void)
   MX_USART2_UART_Init();
   MX_TIM2_Init();
   /* USER CODE BEGIN 2 */
+  trace_init(&trace_irq, trace_irq_data, TRACE_IRQ_RECORDS);
+  trace_init(&trace_app, trace_app_data, TRACE_APP_RECORDS);
   BandpassFilter_Init(&bandpass_filter);
-  cb_init(&adc_buffer, adc_buffer_data, sizeof(adc_buffer_data));
+  NotchFilter_Init(&notch_filter, MAINS_NOTCH);
+  cb_init_elem(&adc_buffer, adc_buffer_data, sizeof(adc_buffer_data), sizeof(adc_sample_t), CB_POLICY_OVERWRITE);
+  cb_set_watermark(&adc_buffer, FRAME_SAMPLES * sizeof(adc_sample_t), Frame_Ready, (void*)&send_flag);
   HAL_TIM_Base_Start_IT(&htim2);
   HAL_ADC_Start_DMA(&hadc1, &ADC_value, 1);
   HAL_ADC_Start_IT(&hadc1);
@@ -119,26 +161,44 @@ int main(void)
     if (send_flag == 1)
     {
       send_flag = 0;
-      uint8_t temp_buffer[256];
-      uint32_t bytes_read = cb_read(&adc_buffer, temp_buffer, 256);
-      if (bytes_read == 256)
+
+      /* The watermark only fires on a crossing, drain every full frame */
+      while (cb_data_count(&adc_buffer) >= FRAME_SAMPLES * sizeof(adc_sample_t))
       {
         int idx = 0;
         sendBuffer[idx++] = START_BYTE;
 
-        for (int i = 0; i < 64; i++)
-        {
-          uint16_t raw_value = (temp_buffer[i * 4] << 8) | temp_buffer[i * 4 + 1];
-          sendBuffer[idx++] = (raw_value >> 8) & 0xFF;
-          sendBuffer[idx++] = raw_value & 0xFF;
-        }
-
-        for (int i = 0; i < 64; i++)
+        /* Samples are read in place, at most two segments per frame */
+        int count = 0;
+        while (count < FRAME_SAMPLES)
         {
-          int16_t bp_value = (temp_buffer[i * 4 + 2] << 8) | temp_buffer[i * 4 + 3];
-          sendBuffer[idx++] = (bp_value >> 8) & 0xFF;
-          sendBuffer[idx++] = bp_value & 0xFF;
+          adc_sample_t *samples;
+          int avail = cb_peek_contiguous(&adc_buffer, (void**)&samples) / sizeof(adc_sample_t);
+          if (avail == 0)
+          {
+            break;
+          }
+          if (avail > FRAME_SAMPLES - count)
+          {
+            avail = FRAME_SAMPLES - count;
+          }
+
+          for (int i = 0; i < avail; i++, count++)
+          {
+            uint8_t *raw = &sendBuffer[1 + count * 2];
+            uint8_t *bp = &sendBuffer[1 + FRAME_SAMPLES * 2 + count * 2];
+            raw[0] = (samples[i].raw >> 8) & 0xFF;
+            raw[1] = samples[i].raw & 0xFF;
+            bp[0] = (samples[i].filtered >> 8) & 0xFF;
+            bp[1] = samples[i].filtered & 0xFF;
+          }
+          if (cb_consume(&adc_buffer, avail * sizeof(adc_sample_t)) != CB_SUCCESS)
+          {
+            /* Overwritten while being copied, drop this frame */
+            break;
+          }
         }
+        idx += FRAME_SAMPLES * 4;
 
         uint8_t checksum = 0;
         for (int i = 1; i < idx; i++)
@@ -149,13 +209,16 @@ int main(void)
 
         sendBuffer[idx++] = END_BYTE;
 
-        HAL_UART_Transmit(&huart2, sendBuffer, idx, 200);
-      }
-      else
-      {
-        char error_msg[] = "Error reading from buffer\n";
-        HAL_UART_Transmit(&huart2, (uint8_t*)error_msg, strlen(error_msg), 200);
+        if (count == FRAME_SAMPLES)
+        {
+          HAL_UART_Transmit(&huart2, sendBuffer, idx, 200);
+        }
       }
+      Report_BufferStats();
+
+      /* Debug records logged since the last frame, bounded so a burst cannot stall frames */
+      trace_drain(&trace_irq, &huart2, TRACE_RECORDS_PER_FRAME);
+      trace_drain(&trace_app, &huart2, TRACE_RECORDS_PER_FRAME);
     }
   }
   /* USER CODE END 3 */
@@ -26,7 +26,7 @@
 /* None */
 
 /* Public variables --------------------------------------------------- */
-uint8_t send_flag = 0;     /**< Flag to indicate when to send data over UART */
+volatile uint8_t send_flag = 0;   /**< Flag to indicate when to send data over UART */
 uint32_t ADC_value;        /**< Raw ADC value read from the sensor */
 
 /* Private variables -------------------------------------------------- */
@@ -0,0 +1,39 @@
+/**
+ * @file       notch.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of the 50/60 Hz mains notch for STM32.
+ *
+ * @note       At 200 Hz the 50 Hz notch has b1 = a1 = 0 (cos(pi/2) = 0),
+ *             the 60 Hz one uses all five coefficients.
+ * @example    stm32f4xx_it.c
+ *             Timer interrupt chaining the notch after the Bandpass Filter.
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "notch.h"
+#include "notch_coeffs.h"
+
+/* Function definitions ----------------------------------------------- */
+void NotchFilter_Init(NotchFilter* filter, NotchMains mains)
+{
+    if (mains == NOTCH_MAINS_60HZ) {
+        BiquadQ15_Init(&filter->biquad, biquad_notch60_fs200_q15, &filter->state, BIQUAD_NOTCH_STAGES,
+                       BIQUAD_NOTCH60_FS200_Q15_SHIFT);
+    } else {
+        BiquadQ15_Init(&filter->biquad, biquad_notch50_fs200_q15, &filter->state, BIQUAD_NOTCH_STAGES,
+                       BIQUAD_NOTCH50_FS200_Q15_SHIFT);
+    }
+}
+
+int32_t NotchFilter_Apply(NotchFilter* filter, int32_t new_sample)
+{
+    // Bandpass output is already clamped to the int16 range
+    return BiquadQ15_Apply(&filter->biquad, (int16_t)new_sample);
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,295 @@
+/**
+ * @file       pan_tompkins.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of the fixed-point Pan-Tompkins QRS detector for STM32.
+ *
+ * @note       Integrated peaks are found as in Hamilton's peak(): track the
+ *             maximum, take it once the signal falls below half of it or
+ *             stops rising for PAN_TOMPKINS_PEAK_TIMEOUT samples. Every
+ *             update is a shift or a running sum; the only loops are the
+ *             R peak scan over the integration window, once per peak.
+ * @example    pan_tompkins.h
+ *             Usage example in the header.
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "pan_tompkins.h"
+#include <string.h>
+
+/* Private defines ---------------------------------------------------- */
+#define PAN_TOMPKINS_INPUT_MASK (PAN_TOMPKINS_INPUT_SIZE - 1)
+#define PAN_TOMPKINS_RR_DEFAULT 160 /* 0.8 s, until real intervals arrive */
+
+// The R peak scan reaches back over the integration window after the timeout
+_Static_assert(PAN_TOMPKINS_INPUT_SIZE > PAN_TOMPKINS_DELAY + PAN_TOMPKINS_MWI_WINDOW + PAN_TOMPKINS_PEAK_TIMEOUT,
+               "bandpass lookback too short");
+_Static_assert((1 << PAN_TOMPKINS_MWI_SHIFT) == PAN_TOMPKINS_MWI_WINDOW, "MWI shift does not match the window");
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Classify one integrated peak as QRS or noise.
+ *
+ * @param[inout]  pt     Pointer to the PanTompkins structure.
+ * @param[in]     value  Integrated peak value.
+ * @param[in]     index  Its sample index.
+ * @param[in]     slope  Largest |derivative| on its rise.
+ * @param[out]    peak   Filled when an R peak is reported.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - 1: peak holds a new R peak
+ *  - 0: No peak reported
+ */
+static uint8_t PanTompkins_ClassifyPeak(PanTompkins* pt, int32_t value, uint32_t index, int32_t slope, QRSPeak* peak);
+
+/**
+ * @brief  Accept a QRS: update SPKI, the RR averages and report its R peak.
+ *
+ * @param[in]  searchback  1 when found by searchback (SPKI updates by 1/4).
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - 1: peak holds a new R peak
+ *  - 0: R peak already reported
+ */
+static uint8_t PanTompkins_AcceptQRS(PanTompkins* pt, int32_t value, uint32_t index, int32_t slope, uint32_t r_index,
+                                     int32_t r_value, uint8_t searchback, QRSPeak* peak);
+
+/**
+ * @brief  Recompute THRESHOLD1 and THRESHOLD2 from SPKI and NPKI.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void PanTompkins_UpdateThresholds(PanTompkins* pt);
+
+/**
+ * @brief  Add one RR interval to both averages and update the missed limit.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void PanTompkins_UpdateRR(PanTompkins* pt, uint16_t rr);
+
+/**
+ * @brief  Largest bandpass sample under the integration window of an integrated peak.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Index of the R peak; its value in *value
+ */
+static uint32_t PanTompkins_LocateR(const PanTompkins* pt, uint32_t index, int32_t* value);
+
+/* Function definitions ----------------------------------------------- */
+void PanTompkins_Init(PanTompkins* pt)
+{
+    memset(pt, 0, sizeof(*pt));
+    for (uint8_t i = 0; i < PAN_TOMPKINS_RR_COUNT; i++) {
+        pt->rr_recent[i] = PAN_TOMPKINS_RR_DEFAULT;
+        pt->rr_regular[i] = PAN_TOMPKINS_RR_DEFAULT;
+    }
+    pt->rr_recent_sum = PAN_TOMPKINS_RR_COUNT * PAN_TOMPKINS_RR_DEFAULT;
+    pt->rr_regular_sum = PAN_TOMPKINS_RR_COUNT * PAN_TOMPKINS_RR_DEFAULT;
+    pt->rr_missed = PAN_TOMPKINS_RR_DEFAULT * 166 / 100;
+}
+
+int32_t PanTompkins_Derivative(PanTompkins* pt, int32_t x)
+{
+    int32_t* h = pt->derivative_history;
+    int32_t y = (2 * x + h[0] - h[2] - 2 * h[3]) >> 3;
+    h[3] = h[2];
+    h[2] = h[1];
+    h[1] = h[0];
+    h[0] = x;
+    return y;
+}
+
+int32_t PanTompkins_Square(int32_t x)
+{
+    // |x| above 4096 would pass the saturation level anyway
+    if (x > 4096 || x < -4096) return PAN_TOMPKINS_SQUARE_MAX;
+    int32_t y = x * x;
+    return (y > PAN_TOMPKINS_SQUARE_MAX) ? PAN_TOMPKINS_SQUARE_MAX : y;
+}
+
+int32_t PanTompkins_Integrate(PanTompkins* pt, int32_t x)
+{
+    uint32_t slot = pt->sample_index & (PAN_TOMPKINS_MWI_WINDOW - 1);
+    pt->mwi_sum += x - pt->mwi_buffer[slot];
+    pt->mwi_buffer[slot] = x;
+    return pt->mwi_sum >> PAN_TOMPKINS_MWI_SHIFT;
+}
+
+uint8_t PanTompkins_Push(PanTompkins* pt, int32_t sample, QRSPeak* peak)
+{
+    uint32_t t = pt->sample_index;
+    uint8_t found = 0;
+
+    pt->input[t & PAN_TOMPKINS_INPUT_MASK] = sample;
+    int32_t slope = PanTompkins_Derivative(pt, sample);
+    int32_t mwi = PanTompkins_Integrate(pt, PanTompkins_Square(slope));
+    pt->sample_index++;
+
+    if (slope < 0) slope = -slope;
+    if (slope > pt->slope) pt->slope = slope;
+
+    // Learning phase: thresholds from 2 s after the bandpass has settled
+    if (t < PAN_TOMPKINS_SETTLE_SAMPLES + PAN_TOMPKINS_LEARN_SAMPLES) {
+        if (t < PAN_TOMPKINS_SETTLE_SAMPLES) return 0;
+        if (mwi > pt->learn_max) pt->learn_max = mwi;
+        pt->learn_sum += mwi;
+        if (t == PAN_TOMPKINS_SETTLE_SAMPLES + PAN_TOMPKINS_LEARN_SAMPLES - 1) {
+            pt->spki = pt->learn_max / 3;
+            pt->npki = (int32_t)(pt->learn_sum / (2 * PAN_TOMPKINS_LEARN_SAMPLES));
+            PanTompkins_UpdateThresholds(pt);
+            pt->peak_value = 0;
+            pt->slope = 0;
+        }
+        return 0;
+    }
+
+    // Integrated peak: rising tracks, falling below half or timing out takes it
+    if (mwi > pt->peak_value) {
+        pt->peak_value = mwi;
+        pt->peak_index = t;
+        pt->peak_slope = pt->slope;
+    } else if (pt->peak_value > 0 &&
+               (mwi < (pt->peak_value >> 1) || t - pt->peak_index > PAN_TOMPKINS_PEAK_TIMEOUT)) {
+        found = PanTompkins_ClassifyPeak(pt, pt->peak_value, pt->peak_index, pt->peak_slope, peak);
+        pt->peak_value = 0;
+        pt->slope = 0;
+    }
+
+    // Searchback: no QRS for 166% of the RR average
+    if (!found && pt->qrs_count > 0 && pt->searchback_valid && t - pt->last_qrs > pt->rr_missed &&
+        pt->searchback_value > pt->threshold2) {
+        found = PanTompkins_AcceptQRS(pt, pt->searchback_value, pt->searchback_index, pt->searchback_slope,
+                                      pt->searchback_r, pt->searchback_amplitude, 1, peak);
+    }
+
+    return found;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint8_t PanTompkins_ClassifyPeak(PanTompkins* pt, int32_t value, uint32_t index, int32_t slope, QRSPeak* peak)
+{
+    int32_t r_value = 0;
+    uint32_t r_index = PanTompkins_LocateR(pt, index, &r_value);
+    uint32_t since = index - pt->last_qrs;
+
+    if (pt->qrs_count > 0 && since < PAN_TOMPKINS_REFRACTORY) {
+        return 0;
+    }
+
+    if (value > pt->threshold1) {
+        // A peak soon after a QRS with half its slope is a T wave
+        if (pt->qrs_count == 0 || since >= PAN_TOMPKINS_T_WAVE || slope >= (pt->last_slope >> 1)) {
+            return PanTompkins_AcceptQRS(pt, value, index, slope, r_index, r_value, 0, peak);
+        }
+    }
+
+    // Noise peak, also the searchback candidate if it is the largest so far
+    pt->npki += (value - pt->npki) >> 3;
+    PanTompkins_UpdateThresholds(pt);
+    if (!pt->searchback_valid || value > pt->searchback_value) {
+        pt->searchback_valid = 1;
+        pt->searchback_value = value;
+        pt->searchback_index = index;
+        pt->searchback_slope = slope;
+        pt->searchback_r = r_index;
+        pt->searchback_amplitude = r_value;
+    }
+    return 0;
+}
+
+static uint8_t PanTompkins_AcceptQRS(PanTompkins* pt, int32_t value, uint32_t index, int32_t slope, uint32_t r_index,
+                                     int32_t r_value, uint8_t searchback, QRSPeak* peak)
+{
+    if (searchback) {
+        pt->spki += (value - pt->spki) >> 2;
+    } else {
+        pt->spki += (value - pt->spki) >> 3;
+    }
+    PanTompkins_UpdateThresholds(pt);
+
+    if (pt->qrs_count > 0) {
+        uint32_t rr = index - pt->last_qrs;
+        PanTompkins_UpdateRR(pt, (rr > UINT16_MAX) ? UINT16_MAX : (uint16_t)rr);
+    }
+    pt->last_qrs = index;
+    pt->last_slope = slope;
+    pt->searchback_valid = 0;
+    if (pt->qrs_count < UINT16_MAX) pt->qrs_count++;
+
+    // Two integrated peaks can share one R peak; report it once
+    if (pt->qrs_count > 1 && r_index <= pt->last_r) {
+        return 0;
+    }
+    pt->last_r = r_index;
+    peak->index = r_index;
+    peak->value = r_value;
+    return 1;
+}
+
+static void PanTompkins_UpdateThresholds(PanTompkins* pt)
+{
+    pt->threshold1 = pt->npki + ((pt->spki - pt->npki) >> 2);
+    pt->threshold2 = pt->threshold1 >> 1;
+}
+
+static void PanTompkins_UpdateRR(PanTompkins* pt, uint16_t rr)
+{
+    pt->rr_recent_sum += rr - pt->rr_recent[pt->rr_index];
+    pt->rr_recent[pt->rr_index] = rr;
+    pt->rr_index = (pt->rr_index + 1) % PAN_TOMPKINS_RR_COUNT;
+
+    // Regular intervals are 92-116% of the regular average
+    uint32_t regular = pt->rr_regular_sum / PAN_TOMPKINS_RR_COUNT;
+    if ((uint32_t)rr * 100 >= regular * 92 && (uint32_t)rr * 100 <= regular * 116) {
+        pt->rr_regular_sum += rr - pt->rr_regular[pt->rr_regular_index];
+        pt->rr_regular[pt->rr_regular_index] = rr;
+        pt->rr_regular_index = (pt->rr_regular_index + 1) % PAN_TOMPKINS_RR_COUNT;
+        pt->rr_irregular = 0;
+    } else if (++pt->rr_irregular >= PAN_TOMPKINS_RR_COUNT) {
+        // The rhythm changed: restart the regular average from the recent one
+        memcpy(pt->rr_regular, pt->rr_recent, sizeof(pt->rr_regular));
+        pt->rr_regular_sum = pt->rr_recent_sum;
+        pt->rr_irregular = 0;
+    }
+
+    pt->rr_missed = (uint16_t)(pt->rr_regular_sum * 166 / (100 * PAN_TOMPKINS_RR_COUNT));
+}
+
+static uint32_t PanTompkins_LocateR(const PanTompkins* pt, uint32_t index, int32_t* value)
+{
+    // Integrated value at index covers derivatives centred on
+    // [index - DELAY - WINDOW + 1, index - DELAY]
+    uint32_t end = (index >= PAN_TOMPKINS_DELAY) ? index - PAN_TOMPKINS_DELAY : 0;
+    uint32_t start = (end >= PAN_TOMPKINS_MWI_WINDOW - 1) ? end - (PAN_TOMPKINS_MWI_WINDOW - 1) : 0;
+    uint32_t best = end;
+    int32_t best_value = pt->input[end & PAN_TOMPKINS_INPUT_MASK];
+
+    for (uint32_t j = start; j < end; j++) {
+        int32_t v = pt->input[j & PAN_TOMPKINS_INPUT_MASK];
+        if (v > best_value) {
+            best_value = v;
+            best = j;
+        }
+    }
+    *value = best_value;
+    return best;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -2,13 +2,15 @@
  * @file       qrs_detector.c
  * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
  * @license    This project is released under the VB's License.
- * @version    1.1.0
- * @date       2025-05-11
+ * @version    1.3.1
+ * @date       2026-10-17
  * @author     Binh Nguyen
  *
  * @brief      Implementation of QRS detection algorithm for STM32 using low static threshold with smart post-processing.
  *
  * @note       This file implements a low static threshold algorithm with smart post-processing for QRS complexes.
+ *             QRSDetector_Push keeps one open candidate group and at most one closed group waiting for the
+ *             samples after it; the refine scan reads them from the lookback ring.
  * @example    main.c
  *             Main application using the QRS detector to identify QRS complexes.
  */
@@ -16,11 +18,14 @@
 /* Includes ----------------------------------------------------------- */
 #include "qrs_detector.h"
 #include "mylib.h"
-#include <stdio.h>
-#include <string.h>
+#include "trace.h"
 
 /* Private defines ---------------------------------------------------- */
-/* None */
+#define QRS_STREAM_RING_MASK (QRS_STREAM_RING_SIZE - 1)
+
+// Oldest sample a group can still need: group start minus the refine window
+_Static_assert(QRS_STREAM_RING_SIZE > QRS_STREAM_LATENCY + QRS_PEAK_WINDOW,
+               "lookback ring too short for the stream latency");
 
 /* Private enumerate/structure ---------------------------------------- */
 /* None */
@@ -35,12 +40,58 @@
 /* None */
 
 /* Private function prototypes ---------------------------------------- */
-/* None */
+/**
+ * @brief  Refine the pending group's peak on the lookback ring and report it.
+ *
+ * @param[inout]  detector  Pointer to the QRSDetector structure.
+ * @param[out]    peak      Filled when the peak is kept.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - 1: peak holds a new peak
+ *  - 0: Peak below QRS_MIN_AMPLITUDE or already reported
+ */
+static uint8_t QRSDetector_FinishGroup(QRSDetector* detector, QRSPeak* peak);
+
+/**
+ * @brief  Refine one QRSDetector_Detect group and flag its peak.
+ *
+ * @param[inout]  detector         Pointer to the QRSDetector structure.
+ * @param[in]     signal           The 2000-sample block.
+ * @param[in]     max_idx          Largest candidate of the group.
+ * @param[in]     amplitude_level  QRS_MIN_AMPLITUDE plus the block mean.
+ * @param[in]     signal_mean      Block mean, for the trace record.
+ * @param[out]    qrs_flags        QRS flags of the block.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void QRSDetector_RefineGroup(QRSDetector* detector, const int32_t* signal, uint16_t max_idx,
+                                    int32_t amplitude_level, int32_t signal_mean, uint8_t* qrs_flags);
 
 /* Function definitions ----------------------------------------------- */
 void QRSDetector_Init(QRSDetector* detector)
 {
     detector->peak_count = 0;
+
+    for (uint16_t i = 0; i < QRS_STREAM_RING_SIZE; i++) {
+        detector->ring[i] = 0;
+    }
+    detector->mean_acc = 0;
+    detector->sample_index = 0;
+    detector->next_candidate = 0;
+    detector->group_start = 0;
+    detector->group_index = 0;
+    detector->group_value = 0;
+    detector->pending_index = 0;
+    detector->last_peak = 0;
+    detector->rr_average = 2 * QRS_MIN_DISTANCE;
+    detector->min_distance = QRS_MIN_DISTANCE;
+    detector->group_open = 0;
+    detector->pending = 0;
 }
 
 void QRSDetector_Detect(QRSDetector* detector, int32_t* signal, uint8_t* qrs_flags)
@@ -60,36 +111,39 @@ void QRSDetector_Detect(QRSDetector* detector, int32_t* signal, uint8_t* qrs_fla
     }
     int32_t signal_mean = (int32_t)(signal_sum / 2000);
 
-    // Debug: Send signal mean
-    char debug_msg[50];
-    sprintf(debug_msg, "DEBUG:MEAN:%ld\n", signal_mean);
-    HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
+    // Debug: Trace signal mean
+    trace_log(&trace_app, TRACE_EV_QRS_MEAN, 0, signal_mean, 0);
 
-    // Step 2: Detect potential QRS peaks using static threshold
-    uint16_t potential_peaks[2000];
-    int32_t potential_values[2000];
+    // The mean is removed once, from the thresholds: signal[i] - mean > T
+    // is signal[i] > T + mean, so the loops below compare raw samples and
+    // only traced and kept values are converted back.
+    int32_t candidate_level = signal_mean + QRS_STATIC_THRESHOLD;
+    int32_t amplitude_level = signal_mean + QRS_MIN_AMPLITUDE;
+
+    // Step 2: Detect potential QRS peaks using static threshold. Candidates
+    // stop at QRS_MAX_PEAKS, so the detector holds exactly that many.
+    uint16_t* potential_peaks = detector->candidate_index;
+    int32_t* potential_values = detector->candidate_value;
     uint16_t potential_count = 0;
 
     for (uint16_t i = 0; i < 2000; i++) {
-        // Remove DC component
-        int32_t adjusted_signal = signal[i] - signal_mean;
+        int32_t sample = signal[i];
 
-        // Debug: Send signal every 100 samples
+        // Debug: Trace signal every 100 samples
         if (i % 100 == 0) {
-            sprintf(debug_msg, "DEBUG:SAMPLE:%u:%ld\n", i, adjusted_signal);
-            HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
+            trace_log(&trace_app, TRACE_EV_QRS_SAMPLE, i, sample - signal_mean, 0);
         }
 
         // Step 3: Check if signal exceeds static threshold
-        if (adjusted_signal > QRS_STATIC_THRESHOLD && adjusted_signal > 0 && potential_count < QRS_MAX_PEAKS) {
+        if (sample > candidate_level && potential_count < QRS_MAX_PEAKS) {
             // Check if this is a local maximum
             int32_t is_peak = 1;
             for (uint16_t j = 1; j <= QRS_PEAK_WINDOW; j++) {
-                if (i >= j && adjusted_signal < (signal[i - j] - signal_mean)) {
+                if (i >= j && sample < signal[i - j]) {
                     is_peak = 0;
                     break;
                 }
-                if (i + j < 2000 && adjusted_signal < (signal[i + j] - signal_mean)) {
+                if (i + j < 2000 && sample < signal[i + j]) {
                     is_peak = 0;
                     break;
                 }
@@ -98,12 +152,11 @@ void QRSDetector_Detect(QRSDetector* detector, int32_t* signal, uint8_t* qrs_fla
             // Step 4: Mark potential QRS peak if it is a local maximum
             if (is_peak) {
                 potential_peaks[potential_count] = i;
-                potential_values[potential_count] = adjusted_signal;
+                potential_values[potential_count] = sample;
                 potential_count++;
 
-                // Debug: Send potential peak
-                sprintf(debug_msg, "DEBUG:POTENTIAL_PEAK:%u:%ld\n", i, adjusted_signal);
-                HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
+                // Debug: Trace potential peak
+                trace_log(&trace_app, TRACE_EV_QRS_POTENTIAL_PEAK, i, sample - signal_mean, 0);
 
                 // Skip the window to avoid multiple detections
                 i += QRS_PEAK_WINDOW;
@@ -117,105 +170,230 @@ void QRSDetector_Detect(QRSDetector* detector, int32_t* signal, uint8_t* qrs_fla
         int32_t total_interval = potential_peaks[potential_count - 1] - potential_peaks[0];
         int32_t avg_interval = total_interval / (potential_count - 1);
         min_distance = (uint16_t)(avg_interval / 2);
-        if (min_distance < 30) min_distance = 30;
+        if (min_distance < QRS_MIN_DISTANCE_FLOOR) min_distance = QRS_MIN_DISTANCE_FLOOR;
         if (min_distance > QRS_MIN_DISTANCE) min_distance = QRS_MIN_DISTANCE;
     }
 
-    // Debug: Send estimated minimum distance
-    sprintf(debug_msg, "DEBUG:MIN_DISTANCE:%u\n", min_distance);
-    HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
+    // Debug: Trace estimated minimum distance
+    trace_log(&trace_app, TRACE_EV_QRS_MIN_DISTANCE, min_distance, 0, 0);
+
+    // Step 6: Merge candidates in one pass. A group runs from its first
+    // candidate over min_distance samples and keeps its largest candidate;
+    // the candidate that falls past the group end closes it and starts the next.
+    uint16_t group_end = 0;
+    uint16_t group_idx = 0;
+    int32_t group_value = 0;
 
-    // Step 6: Post-process to filter peaks
     for (uint16_t i = 0; i < potential_count; i++) {
-        uint16_t start_idx = potential_peaks[i];
-        uint16_t end_idx = start_idx + min_distance;
-        if (end_idx >= 2000) end_idx = 1999;
+        if (i > 0 && potential_peaks[i] <= group_end) {
+            if (potential_values[i] > group_value) {
+                group_idx = potential_peaks[i];
+                group_value = potential_values[i];
+            }
+            continue;
+        }
 
-        int32_t max_value = potential_values[i];
-        uint16_t max_idx = start_idx;
+        if (i > 0) {
+            QRSDetector_RefineGroup(detector, signal, group_idx, amplitude_level, signal_mean, qrs_flags);
+        }
+        group_end = potential_peaks[i] + min_distance;
+        group_idx = potential_peaks[i];
+        group_value = potential_values[i];
+    }
+    if (potential_count > 0) {
+        QRSDetector_RefineGroup(detector, signal, group_idx, amplitude_level, signal_mean, qrs_flags);
+    }
 
-        for (uint16_t j = i + 1; j < potential_count; j++) {
-            if (potential_peaks[j] > end_idx) break;
+    // Debug: Trace total number of detected peaks. The decoder rebuilds the
+    // QRS_INDICES line from the PEAK records before it.
+    trace_log(&trace_app, TRACE_EV_QRS_TOTAL, detector->peak_count, 0, 0);
+}
 
-            if (potential_values[j] > max_value) {
-                max_value = potential_values[j];
-                max_idx = potential_peaks[j];
-            }
-            i = j;
+uint8_t QRSDetector_Push(QRSDetector* detector, int32_t sample, QRSPeak* peak)
+{
+    uint32_t t = detector->sample_index++;
+    uint8_t found = 0;
+
+    // Remove DC with a running mean. Until 2^QRS_STREAM_MEAN_SHIFT samples
+    // have arrived mean_acc is their plain sum, which then equals mean << shift.
+    // After that QRS spikes are clipped to the threshold so they do not lift
+    // the baseline the next beat is measured against.
+    int32_t mean;
+    if (t < (1u << QRS_STREAM_MEAN_SHIFT)) {
+        detector->mean_acc += sample;
+        mean = detector->mean_acc / (int32_t)(t + 1);
+    } else {
+        mean = detector->mean_acc >> QRS_STREAM_MEAN_SHIFT;
+        int32_t clipped = sample - mean;
+        if (clipped > QRS_STATIC_THRESHOLD) clipped = QRS_STATIC_THRESHOLD;
+        detector->mean_acc += clipped;
+    }
+    int32_t adjusted = sample - mean;
+    detector->ring[t & QRS_STREAM_RING_MASK] = adjusted;
+
+    // Sample c now has QRS_PEAK_WINDOW samples on both sides
+    if (t < QRS_PEAK_WINDOW) {
+        return 0;
+    }
+    uint32_t c = t - QRS_PEAK_WINDOW;
+    int32_t value = detector->ring[c & QRS_STREAM_RING_MASK];
+
+    // No later candidate can join the open group: close it
+    if (detector->group_open && c > detector->group_start + detector->min_distance) {
+        if (detector->pending) {
+            found = QRSDetector_FinishGroup(detector, peak);
         }
+        detector->pending_index = detector->group_index;
+        detector->pending = 1;
+        detector->group_open = 0;
+    }
 
-        uint16_t refine_start = (max_idx < QRS_PEAK_REFINE_WINDOW) ? 0 : max_idx - QRS_PEAK_REFINE_WINDOW;
-        uint16_t refine_end = (max_idx + QRS_PEAK_REFINE_WINDOW >= 2000) ? 1999 : max_idx + QRS_PEAK_REFINE_WINDOW;
-        int32_t refined_max_value = signal[max_idx] - signal_mean;
-        uint16_t refined_max_idx = max_idx;
+    // Same candidate test as QRSDetector_Detect steps 3 and 4
+    if (c >= detector->next_candidate && value > QRS_STATIC_THRESHOLD) {
+        uint8_t is_peak = 1;
+        for (uint16_t j = 1; j <= QRS_PEAK_WINDOW; j++) {
+            if ((c >= j && value < detector->ring[(c - j) & QRS_STREAM_RING_MASK]) ||
+                value < detector->ring[(c + j) & QRS_STREAM_RING_MASK]) {
+                is_peak = 0;
+                break;
+            }
+        }
 
-        for (uint16_t j = refine_start; j <= refine_end; j++) {
-            int32_t value = signal[j] - signal_mean;
-            if (value > refined_max_value) {
-                refined_max_value = value;
-                refined_max_idx = j;
+        if (is_peak) {
+            detector->next_candidate = c + QRS_PEAK_WINDOW + 1;
+            if (!detector->group_open) {
+                detector->group_open = 1;
+                detector->group_start = c;
+                detector->group_index = c;
+                detector->group_value = value;
+            } else if (value > detector->group_value) {
+                detector->group_index = c;
+                detector->group_value = value;
             }
         }
+    }
+
+    // The refine window of the closed group is complete
+    if (!found && detector->pending && t >= detector->pending_index + QRS_PEAK_REFINE_WINDOW) {
+        found = QRSDetector_FinishGroup(detector, peak);
+    }
 
-        if (refined_max_value > QRS_MIN_AMPLITUDE && detector->peak_count < QRS_MAX_PEAKS) {
-            qrs_flags[refined_max_idx] = 1;
-            detector->peak_count++;
+    return found;
+}
 
-            sprintf(debug_msg, "DEBUG:PEAK:%u:%ld\n", refined_max_idx, refined_max_value);
-            HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
+uint8_t QRSDetector_Flush(QRSDetector* detector, QRSPeak* peak)
+{
+    // Same order as Push closing a group: finish the pending group first,
+    // then the open group becomes pending and is finished on the next pass
+    while (detector->pending || detector->group_open) {
+        uint8_t found = 0;
+        if (detector->pending) {
+            found = QRSDetector_FinishGroup(detector, peak);
+        }
+        if (detector->group_open) {
+            detector->pending_index = detector->group_index;
+            detector->pending = 1;
+            detector->group_open = 0;
+        }
+        if (found) {
+            return 1;
         }
     }
 
-    // Debug: Send total number of detected peaks
-    sprintf(debug_msg, "DEBUG:TOTAL:%u\n", detector->peak_count);
-    HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, strlen(debug_msg), 200);
+    return 0;
+}
 
-    // Debug: Send indices of detected QRS peaks
-    sprintf(debug_msg, "DEBUG:QRS_INDICES:");
-    int msg_len = strlen(debug_msg);
-    for (uint16_t i = 0; i < 2000; i++) {
-        if (qrs_flags[i] == 1) {
-            char index_str[10];
-            sprintf(index_str, "%u,", i);
-            int index_len = strlen(index_str);
-            if (msg_len + index_len < sizeof(debug_msg) - 1) {
-                strcat(debug_msg, index_str);
-                msg_len += index_len;
-            } else {
-                HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, msg_len, 200);
-                sprintf(debug_msg, "DEBUG:QRS_INDICES:%s", index_str);
-                msg_len = strlen(debug_msg);
-            }
+uint32_t QRSDetector_DetectRecord(QRSDetector* detector, const int32_t* signal, uint32_t length, uint32_t* peaks,
+                                  uint32_t capacity)
+{
+    uint32_t count = 0;
+    QRSPeak peak;
+
+    QRSDetector_Init(detector);
+
+    for (uint32_t i = 0; i < length; i++) {
+        if (QRSDetector_Push(detector, signal[i], &peak)) {
+            if (count < capacity) peaks[count] = peak.index;
+            count++;
         }
     }
-    if (msg_len > strlen("DEBUG:QRS_INDICES:")) {
-        debug_msg[msg_len - 1] = '\n';
-        HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, msg_len, 200);
-    }
-
-    // Debug: Verify first_10s_qrs_flags content
-    sprintf(debug_msg, "DEBUG:QRS_FLAGS_SAMPLE:");
-    msg_len = strlen(debug_msg);
-    for (uint16_t i = 0; i < 2000; i += 100) {
-        char flag_str[10];
-        sprintf(flag_str, "%u:%u,", i, qrs_flags[i]);
-        int flag_len = strlen(flag_str);
-        if (msg_len + flag_len < sizeof(debug_msg) - 1) {
-            strcat(debug_msg, flag_str);
-            msg_len += flag_len;
-        } else {
-            HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, msg_len, 200);
-            sprintf(debug_msg, "DEBUG:QRS_FLAGS_SAMPLE:%s", flag_str);
-            msg_len = strlen(debug_msg);
+
+    while (QRSDetector_Flush(detector, &peak)) {
+        if (count < capacity) peaks[count] = peak.index;
+        count++;
+    }
+
+    trace_log(&trace_app, TRACE_EV_QRS_TOTAL, (uint16_t)(count > UINT16_MAX ? UINT16_MAX : count), 0, 0);
+
+    return count;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void QRSDetector_RefineGroup(QRSDetector* detector, const int32_t* signal, uint16_t max_idx,
+                                    int32_t amplitude_level, int32_t signal_mean, uint8_t* qrs_flags)
+{
+    uint16_t refine_start = (max_idx < QRS_PEAK_REFINE_WINDOW) ? 0 : max_idx - QRS_PEAK_REFINE_WINDOW;
+    uint16_t refine_end = (max_idx + QRS_PEAK_REFINE_WINDOW >= 2000) ? 1999 : max_idx + QRS_PEAK_REFINE_WINDOW;
+    int32_t refined_max_value = signal[max_idx];
+    uint16_t refined_max_idx = max_idx;
+
+    for (uint16_t j = refine_start; j <= refine_end; j++) {
+        if (signal[j] > refined_max_value) {
+            refined_max_value = signal[j];
+            refined_max_idx = j;
         }
     }
-    if (msg_len > strlen("DEBUG:QRS_FLAGS_SAMPLE:")) {
-        debug_msg[msg_len - 1] = '\n';
-        HAL_UART_Transmit(&huart2, (uint8_t*)debug_msg, msg_len, 200);
+
+    if (refined_max_value > amplitude_level && detector->peak_count < QRS_MAX_PEAKS) {
+        qrs_flags[refined_max_idx] = 1;
+        detector->peak_count++;
+
+        trace_log(&trace_app, TRACE_EV_QRS_PEAK, refined_max_idx, refined_max_value - signal_mean, 0);
     }
 }
 
-/* Private definitions ----------------------------------------------- */
-/* None */
+static uint8_t QRSDetector_FinishGroup(QRSDetector* detector, QRSPeak* peak)
+{
+    uint32_t max_idx = detector->pending_index;
+    uint32_t newest = detector->sample_index - 1;
+    uint32_t refine_start = (max_idx < QRS_PEAK_REFINE_WINDOW) ? 0 : max_idx - QRS_PEAK_REFINE_WINDOW;
+    uint32_t refine_end = max_idx + QRS_PEAK_REFINE_WINDOW;
+    if (refine_end > newest) refine_end = newest;
+
+    detector->pending = 0;
+
+    int32_t refined_max_value = detector->ring[max_idx & QRS_STREAM_RING_MASK];
+    uint32_t refined_max_idx = max_idx;
+    for (uint32_t j = refine_start; j <= refine_end; j++) {
+        int32_t value = detector->ring[j & QRS_STREAM_RING_MASK];
+        if (value > refined_max_value) {
+            refined_max_value = value;
+            refined_max_idx = j;
+        }
+    }
+
+    // Two groups can refine onto the same peak; report it once
+    if (refined_max_value <= QRS_MIN_AMPLITUDE || (detector->peak_count > 0 && refined_max_idx <= detector->last_peak)) {
+        return 0;
+    }
+
+    // Group length follows half the RR interval, as Detect step 5
+    if (detector->peak_count > 0) {
+        uint32_t rr = refined_max_idx - detector->last_peak;
+        if (rr > 4 * QRS_MIN_DISTANCE) rr = 4 * QRS_MIN_DISTANCE;
+        detector->rr_average = (uint16_t)((int32_t)detector->rr_average + ((int32_t)rr - (int32_t)detector->rr_average) / 8);
+        uint16_t min_distance = detector->rr_average / 2;
+        if (min_distance < QRS_MIN_DISTANCE_FLOOR) min_distance = QRS_MIN_DISTANCE_FLOOR;
+        if (min_distance > QRS_MIN_DISTANCE) min_distance = QRS_MIN_DISTANCE;
+        detector->min_distance = min_distance;
+    }
+
+    detector->last_peak = refined_max_idx;
+    if (detector->peak_count < UINT16_MAX) detector->peak_count++;
+
+    peak->index = refined_max_idx;
+    peak->value = refined_max_value;
+    return 1;
+}
 
 /* End of file -------------------------------------------------------- */
@@ -0,0 +1,155 @@
+/**
+ * @file       spsc_ring.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of single producer, single consumer ring
+ *             using C11 atomics.
+ *
+ * @note       Producer: relaxed load of its own head, acquire load of tail
+ *             only when the cached tail shows no room, release store of head
+ *             after the copy. Consumer mirrors this with tail/head.
+ * @example    spsc_ring.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "spsc_ring.h"
+
+/* Private macros ----------------------------------------------------- */
+/**
+ * @brief  Non-zero when x is a power of two greater than 1.
+ */
+#define SPSC_IS_POW2(x) ((x) > 1 && ((x) & ((x) - 1)) == 0)
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Number of elements of a n-element transfer that fit before the
+ *         end of the storage array.
+ *
+ * @param[in]  ring   Pointer to a spsc_ring_t structure.
+ * @param[in]  index  Free-running index where the transfer starts.
+ * @param[in]  n      Number of elements in the transfer.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Elements in the first segment
+ */
+static uint32_t spsc_first_segment(const spsc_ring_t *ring, uint32_t index, uint32_t n);
+
+/* Function definitions ----------------------------------------------- */
+uint32_t spsc_init(spsc_ring_t *ring, void *buf, uint32_t count, uint32_t elem_size)
+{
+    if (ring == NULL || buf == NULL || !SPSC_IS_POW2(count) || elem_size == 0)
+        return SPSC_ERROR;
+
+    ring->data = buf;
+    ring->count = count;
+    ring->mask = count - 1;
+    ring->elem_size = elem_size;
+    ring->cached_tail = 0;
+    ring->cached_head = 0;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+
+    return SPSC_SUCCESS;
+}
+
+uint32_t spsc_write(spsc_ring_t *ring, const void *items, uint32_t n)
+{
+    uint32_t head = 0;
+    uint32_t space = 0;
+    uint32_t first = 0;
+    const uint8_t *src = items;
+    if (ring == NULL || items == NULL)
+        return SPSC_ERROR;
+
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    space = ring->count - (head - ring->cached_tail);
+    if (space < n)
+    {
+        ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        space = ring->count - (head - ring->cached_tail);
+    }
+    if (n > space)
+        n = space;
+    if (n == 0)
+        return 0;
+
+    first = spsc_first_segment(ring, head, n);
+    memcpy(ring->data + (head & ring->mask) * ring->elem_size, src, first * ring->elem_size);
+    if (n > first)
+        memcpy(ring->data, src + first * ring->elem_size, (n - first) * ring->elem_size);
+
+    atomic_store_explicit(&ring->head, head + n, memory_order_release);
+    return n;
+}
+
+uint32_t spsc_read(spsc_ring_t *ring, void *items, uint32_t n)
+{
+    uint32_t tail = 0;
+    uint32_t avail = 0;
+    uint32_t first = 0;
+    uint8_t *dst = items;
+    if (ring == NULL || items == NULL)
+        return SPSC_ERROR;
+
+    tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    avail = ring->cached_head - tail;
+    if (avail < n)
+    {
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        avail = ring->cached_head - tail;
+    }
+    if (n > avail)
+        n = avail;
+    if (n == 0)
+        return 0;
+
+    first = spsc_first_segment(ring, tail, n);
+    memcpy(dst, ring->data + (tail & ring->mask) * ring->elem_size, first * ring->elem_size);
+    if (n > first)
+        memcpy(dst + first * ring->elem_size, ring->data, (n - first) * ring->elem_size);
+
+    atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+    return n;
+}
+
+uint32_t spsc_data_count(spsc_ring_t *ring)
+{
+    uint32_t tail = 0;
+    uint32_t count = 0;
+    if (ring == NULL)
+        return SPSC_ERROR;
+
+    tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    count = atomic_load_explicit(&ring->head, memory_order_acquire) - tail;
+    if (count > ring->count)
+        count = ring->count;
+
+    return count;
+}
+
+uint32_t spsc_space_count(spsc_ring_t *ring)
+{
+    uint32_t count = spsc_data_count(ring);
+    if (count == SPSC_ERROR)
+        return SPSC_ERROR;
+
+    return ring->count - count;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint32_t spsc_first_segment(const spsc_ring_t *ring, uint32_t index, uint32_t n)
+{
+    uint32_t first = ring->count - (index & ring->mask);
+    if (first > n)
+        first = n;
+
+    return first;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -20,13 +20,16 @@
 #include "stm32f4xx_it.h"
 #include "mylib.h"
 #include "filter.h"
+#include "notch.h"
 #include "cbuffer.h"
+#include "adc_sample.h"
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN PV */
 extern BandpassFilter bandpass_filter;
+extern NotchFilter notch_filter;
 extern cbuffer_t adc_buffer;
-extern uint8_t adc_buffer_data[512];
+extern adc_sample_t adc_buffer_data[ADC_SAMPLE_RING_SIZE];
 /* USER CODE END PV */
 
 /* External variables --------------------------------------------------------*/
@@ -102,22 +105,14 @@ void SysTick_Handler(void)
 void TIM2_IRQHandler(void)
 {
   uint16_t raw_value = (uint16_t)ADC_value;
-  int32_t bandpass = BandpassFilter_Apply(&bandpass_filter, raw_value);
+  int32_t bandpass = NotchFilter_Apply(&notch_filter, BandpassFilter_Apply(&bandpass_filter, raw_value));
 
-  uint8_t raw_high_byte = (raw_value >> 8) & 0xFF;
-  uint8_t raw_low_byte = raw_value & 0xFF;
-  uint8_t bp_high_byte = (bandpass >> 8) & 0xFF;
-  uint8_t bp_low_byte = bandpass & 0xFF;
+  adc_sample_t sample;
+  sample.raw = raw_value;
+  sample.filtered = (int16_t)bandpass;
 
-  cb_write(&adc_buffer, &raw_high_byte, 1);
-  cb_write(&adc_buffer, &raw_low_byte, 1);
-  cb_write(&adc_buffer, &bp_high_byte, 1);
-  cb_write(&adc_buffer, &bp_low_byte, 1);
-
-  if (cb_data_count(&adc_buffer) >= 256)
-  {
-    send_flag = 1;
-  }
+  /* Raises send_flag through the watermark callback once a frame is ready */
+  cb_write(&adc_buffer, &sample, sizeof(sample));
 
   HAL_TIM_IRQHandler(&htim2);
 }
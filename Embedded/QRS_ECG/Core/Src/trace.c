@@ -0,0 +1,148 @@
+/**
+ * @file       trace.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Implementation of the deferred binary trace log.
+ *
+ * @note       Packet on the wire: TRACE_SYNC, the 16 record bytes, then the
+ *             low byte of the sum of the record bytes.
+ * @example    main.c
+ *             Main application draining the trace logs after each frame.
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "trace.h"
+
+/* Private defines ---------------------------------------------------- */
+#define TRACE_UART_TIMEOUT (10) /*!< ms, one packet takes ~5 ms at 38400 baud */
+
+/* Public variables --------------------------------------------------- */
+trace_t trace_irq;
+trace_t trace_app;
+trace_record_t trace_irq_data[TRACE_IRQ_RECORDS];
+trace_record_t trace_app_data[TRACE_APP_RECORDS];
+
+/* The decoder reads records as 16 packed little-endian bytes */
+_Static_assert(sizeof(trace_record_t) == TRACE_PACKET_SIZE - 2, "trace_record_t must stay 16 bytes");
+
+/* Private variables -------------------------------------------------- */
+#if !defined(DWT)
+static uint32_t trace_sequence = 0; /**< Host timestamp, counts records */
+#endif
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Current timestamp.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - DWT cycle count on Cortex-M, record sequence number elsewhere
+ */
+static inline uint32_t trace_now(void);
+
+/**
+ * @brief  Send one record as a packet.
+ *
+ * @param[in]  huart   UART to send on.
+ * @param[in]  record  Record to send.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void trace_send(UART_HandleTypeDef *huart, const trace_record_t *record);
+
+/* Function definitions ----------------------------------------------- */
+uint32_t trace_init(trace_t *trace, trace_record_t *storage, uint32_t count)
+{
+    if (trace == NULL || storage == NULL)
+        return TRACE_ERROR;
+
+    if (cb_init_elem(&trace->ring, storage, count * sizeof(trace_record_t), sizeof(trace_record_t),
+                     CB_POLICY_DROP_NEW) != CB_SUCCESS)
+        return TRACE_ERROR;
+
+    trace->reported_lost = 0;
+
+#if defined(DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    return TRACE_SUCCESS;
+}
+
+void trace_log(trace_t *trace, uint16_t event, uint16_t arg0, int32_t arg1, int32_t arg2)
+{
+    trace_record_t record;
+    record.timestamp = trace_now();
+    record.event = event;
+    record.arg0 = arg0;
+    record.arg1 = arg1;
+    record.arg2 = arg2;
+
+    /* Drop-new: a full ring loses this record and counts it */
+    cb_write(&trace->ring, &record, sizeof(record));
+}
+
+uint32_t trace_drain(trace_t *trace, UART_HandleTypeDef *huart, uint32_t max_records)
+{
+    trace_record_t record;
+    cb_stats_t stats;
+    uint32_t sent = 0;
+    if (trace == NULL || huart == NULL || !trace->ring.active)
+        return 0;
+
+    cb_get_stats(&trace->ring, &stats);
+    if (stats.dropped != trace->reported_lost && max_records > 0)
+    {
+        record.timestamp = trace_now();
+        record.event = TRACE_EV_LOST;
+        record.arg0 = 0;
+        record.arg1 = (int32_t)(stats.dropped - trace->reported_lost);
+        record.arg2 = 0;
+        trace->reported_lost = stats.dropped;
+        trace_send(huart, &record);
+        sent++;
+    }
+
+    while (sent < max_records && cb_read(&trace->ring, &record, sizeof(record)) == sizeof(record))
+    {
+        trace_send(huart, &record);
+        sent++;
+    }
+
+    return sent;
+}
+
+/* Private definitions ----------------------------------------------- */
+static inline uint32_t trace_now(void)
+{
+#if defined(DWT)
+    return DWT->CYCCNT;
+#else
+    return trace_sequence++;
+#endif
+}
+
+static void trace_send(UART_HandleTypeDef *huart, const trace_record_t *record)
+{
+    uint8_t packet[TRACE_PACKET_SIZE];
+    uint8_t checksum = 0;
+
+    packet[0] = TRACE_SYNC;
+    memcpy(&packet[1], record, sizeof(*record));
+    for (uint32_t i = 1; i <= sizeof(*record); i++)
+        checksum += packet[i];
+    packet[TRACE_PACKET_SIZE - 1] = checksum;
+
+    HAL_UART_Transmit(huart, packet, TRACE_PACKET_SIZE, TRACE_UART_TIMEOUT);
+}
+
+/* End of file -------------------------------------------------------- */
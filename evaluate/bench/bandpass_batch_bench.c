@@ -0,0 +1,184 @@
+/**
+ * @file       bandpass_batch_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Bit-exact check and single-core throughput of the batch
+ *             Bandpass Filter (scalar and AVX2) against the firmware filter.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 -I evaluate/native evaluate/bench/bandpass_batch_bench.c
+ *                 evaluate/native/bandpass_batch.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o bandpass_batch_bench
+ *             ./bandpass_batch_bench [evaluate/data/100.dat]
+ *             Channels are both leads of record 100, each cut into 8
+ *             segments, so 16 independent 81250-sample recordings.
+ * @example    bandpass_batch_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "bandpass_batch.h"
+#include "filter.h"
+#include "mitbih.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_SEGMENTS (8)  /*!< Segments per lead */
+#define BENCH_REPEAT   (10) /*!< Passes per case */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/**
+ * @brief  Count samples that differ between two channel sets.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of mismatches
+ */
+static size_t bench_compare(int32_t* const* a, int32_t* const* b, size_t channels, size_t n);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n0 = 0;
+    size_t n1 = 0;
+    int32_t *lead[2];
+    lead[0] = mitbih_load(path, 2, 0, &n0);
+    lead[1] = mitbih_load(path, 2, 1, &n1);
+    if (lead[0] == NULL || lead[1] == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    const size_t channels = 2 * BENCH_SEGMENTS;
+    const size_t n = n0 / BENCH_SEGMENTS;
+    const int32_t *in[2 * BENCH_SEGMENTS];
+    int32_t *expected[2 * BENCH_SEGMENTS];
+    int32_t *actual[2 * BENCH_SEGMENTS];
+    for (size_t c = 0; c < channels; c++)
+    {
+        in[c] = lead[c & 1] + (c / 2) * n;
+        expected[c] = malloc(n * sizeof(int32_t));
+        actual[c] = malloc(n * sizeof(int32_t));
+    }
+
+    BandpassBatch batch;
+    BandpassFilter filter;
+    size_t mismatches = 0;
+    uint64_t t0 = 0;
+    double reference_ns = 0;
+    double scalar_ns = 0;
+    double avx2_ns = 0;
+    double run_ns = 0;
+    const double total = (double)channels * n * BENCH_REPEAT;
+
+    /* Firmware filter, one channel at a time */
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        for (size_t c = 0; c < channels; c++)
+        {
+            BandpassFilter_Init(&filter);
+            BandpassFilter_ApplyBlock(&filter, in[c], expected[c], n);
+        }
+    }
+    reference_ns = (double)(bench_now() - t0);
+
+    BandpassBatch_Init(&batch, BANDPASS_BATCH_SCALAR);
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+        BandpassBatch_FilterChannels(&batch, in, actual, channels, n);
+    scalar_ns = (double)(bench_now() - t0);
+    mismatches += bench_compare(expected, actual, channels, n);
+
+    int have_avx2 = BandpassBatch_Init(&batch, BANDPASS_BATCH_AVX2);
+    for (size_t c = 0; c < channels; c++)
+        memset(actual[c], 0, n * sizeof(int32_t));
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+        BandpassBatch_FilterChannels(&batch, in, actual, channels, n);
+    avx2_ns = (double)(bench_now() - t0);
+    mismatches += bench_compare(expected, actual, channels, n);
+
+    /* Kernel alone on data already interleaved, 8 channels */
+    int32_t *lanes = malloc(n * BANDPASS_BATCH_LANES * sizeof(int32_t));
+    int32_t *lanes_out = malloc(n * BANDPASS_BATCH_LANES * sizeof(int32_t));
+    for (size_t t = 0; t < n; t++)
+        for (size_t l = 0; l < BANDPASS_BATCH_LANES; l++)
+            lanes[t * BANDPASS_BATCH_LANES + l] = in[l][t];
+    t0 = bench_now();
+    for (int r = 0; r < 2 * BENCH_REPEAT; r++)
+    {
+        BandpassBatch_Reset(&batch);
+        BandpassBatch_Run(&batch, lanes, lanes_out, n);
+    }
+    run_ns = (double)(bench_now() - t0);
+    for (size_t t = 0; t < n; t++)
+        for (size_t l = 0; l < BANDPASS_BATCH_LANES; l++)
+            if (lanes_out[t * BANDPASS_BATCH_LANES + l] != expected[l][t])
+                mismatches++;
+
+    printf("{\n  \"benchmark\": \"bandpass_batch\",\n  \"channels\": %zu,\n  \"samples_per_channel\": %zu,\n",
+           channels, n);
+    printf("  \"avx2\": %s,\n  \"mismatches\": %zu,\n", have_avx2 ? "true" : "false", mismatches);
+    printf("  \"msamples_per_s\": {\n");
+    printf("    \"firmware_block\": %.1f,\n", total * 1e3 / reference_ns);
+    printf("    \"batch_scalar\": %.1f,\n", total * 1e3 / scalar_ns);
+    printf("    \"batch_%s\": %.1f,\n", have_avx2 ? "avx2" : "scalar_fallback", total * 1e3 / avx2_ns);
+    printf("    \"kernel_interleaved\": %.1f\n  }\n}\n",
+           (double)BANDPASS_BATCH_LANES * n * 2 * BENCH_REPEAT * 1e3 / run_ns);
+
+    for (size_t c = 0; c < channels; c++)
+    {
+        free(expected[c]);
+        free(actual[c]);
+    }
+    free(lanes);
+    free(lanes_out);
+    free(lead[0]);
+    free(lead[1]);
+    return mismatches ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static size_t bench_compare(int32_t* const* a, int32_t* const* b, size_t channels, size_t n)
+{
+    size_t mismatches = 0;
+    for (size_t c = 0; c < channels; c++)
+        for (size_t t = 0; t < n; t++)
+            if (a[c][t] != b[c][t])
+                mismatches++;
+
+    return mismatches;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,209 @@
+/**
+ * @file       bandpass_tmpl_bench.cpp
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Compile-time test matrix and benchmark for bandpass.hpp.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -c -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c
+ *                 evaluate/bench/host/hal_stub.c evaluate/bench/mitbih.c
+ *             g++ -std=c++17 -O2 -I evaluate/bench/host
+ *                 -I Embedded/QRS_ECG/Core/Inc -I evaluate/bench
+ *                 evaluate/bench/bandpass_tmpl_bench.cpp filter.o trace.o
+ *                 cbuffer.o hal_stub.o mitbih.o -o bandpass_tmpl_bench
+ *             ./bandpass_tmpl_bench [evaluate/data/100.dat]
+ *             The static_assert matrix fails the build if any derived
+ *             constant or any instantiation's output changes. The run checks
+ *             Bandpass<200, 500, 40000> against BandpassFilter_ApplyBlock on
+ *             record 100 and prints ns/sample per instantiation as JSON.
+ * @example    bandpass_tmpl_bench.cpp
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "bandpass.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+#include "filter.h"
+#include "mitbih.h"
+}
+
+/* Private definitions ----------------------------------------------- */
+namespace
+{
+constexpr size_t kCheckSamples = 300; /**< Samples run at compile time per case */
+constexpr int kRepeat = 10;           /**< Passes over the record per case */
+
+/**
+ * @brief  Reference with the constants spelled out and no running sums:
+ *         both windows are re-summed in full for every sample.
+ */
+template <uint32_t L, int32_t Scale, uint32_t H, uint32_t Shift, size_t N>
+constexpr bool matches_reference(const int32_t (&out)[N], const int32_t (&in)[N])
+{
+    int32_t x[L] = {};
+    int32_t lp[H] = {};
+    for (size_t n = 0; n < N; n++)
+    {
+        for (uint32_t i = L - 1; i > 0; i--)
+            x[i] = x[i - 1];
+        x[0] = in[n];
+        int64_t sum = 0;
+        for (uint32_t i = 0; i < L; i++)
+            sum += x[i];
+        int32_t lowpass = static_cast<int32_t>((sum * Scale) >> 10);
+
+        for (uint32_t i = H - 1; i > 0; i--)
+            lp[i] = lp[i - 1];
+        lp[0] = lowpass;
+        int64_t avg = 0;
+        for (uint32_t i = 0; i < H; i++)
+            avg += lp[i];
+        int64_t y = lowpass - (avg >> Shift);
+        y = y > 32767 ? 32767 : (y < -32768 ? -32768 : y);
+        if (out[n] != y)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief  Run one instantiation at compile time on a pseudo-random 12-bit
+ *         signal (every lane gets a different one) and compare each lane
+ *         with the reference.
+ */
+template <typename F, uint32_t L, int32_t Scale, uint32_t H, uint32_t Shift>
+constexpr bool check_case()
+{
+    static_assert(F::kLowpassWindow == L, "low-pass window");
+    static_assert(F::kLowpassScale == Scale, "low-pass scale");
+    static_assert(F::kHighpassWindow == H, "high-pass window");
+    static_assert(F::kHighpassShift == Shift, "high-pass shift");
+
+    F filter;
+    int32_t in[F::kLanes][kCheckSamples] = {};
+    int32_t out[F::kLanes][kCheckSamples] = {};
+    uint32_t seed = 12345;
+    for (size_t n = 0; n < kCheckSamples; n++)
+    {
+        int32_t step_in[F::kLanes] = {};
+        int32_t step_out[F::kLanes] = {};
+        for (size_t l = 0; l < F::kLanes; l++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            step_in[l] = static_cast<int32_t>(seed >> 20) - 2048;
+            in[l][n] = step_in[l];
+        }
+        filter.step(step_in, step_out);
+        for (size_t l = 0; l < F::kLanes; l++)
+            out[l][n] = step_out[l];
+    }
+    for (size_t l = 0; l < F::kLanes; l++)
+        if (!matches_reference<L, Scale, H, Shift>(out[l], in[l]))
+            return false;
+    return true;
+}
+
+/* Test matrix: rate x band x lanes, with the expected derived constants */
+static_assert(check_case<Bandpass<200, 500, 40000>, 5, 384, 64, 7>(), "200 Hz, filter.c constants");
+static_assert(check_case<Bandpass<200, 500, 40000, 3>, 5, 384, 64, 7>(), "200 Hz, 3 leads");
+static_assert(check_case<Bandpass<250, 500, 40000>, 6, 320, 128, 8>(), "250 Hz");
+static_assert(check_case<Bandpass<360, 500, 40000, 2>, 9, 213, 128, 8>(), "360 Hz, 2 leads");
+static_assert(check_case<Bandpass<500, 500, 40000>, 13, 148, 256, 9>(), "500 Hz");
+static_assert(check_case<Bandpass<500, 1000, 25000>, 20, 96, 128, 8>(), "500 Hz, 1-25 Hz");
+static_assert(check_case<Bandpass<128, 500, 32000>, 4, 480, 64, 7>(), "128 Hz, power-of-two low-pass window");
+
+/**
+ * @brief  ns/sample of one instantiation over n steps of interleaved data.
+ */
+template <typename F>
+double bench_case(const std::vector<int32_t> &in, std::vector<int32_t> &out, size_t steps)
+{
+    F filter;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRepeat; r++)
+    {
+        filter.reset();
+        filter.apply_block(in.data(), out.data(), steps);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / (static_cast<double>(steps) * F::kLanes * kRepeat);
+}
+
+/**
+ * @brief  Print one JSON result and return the separator for the next.
+ */
+template <typename F>
+void emit(const char *name, const std::vector<int32_t> &record, bool last)
+{
+    size_t steps = record.size() / F::kLanes;
+    std::vector<int32_t> out(steps * F::kLanes);
+    double ns = bench_case<F>(record, out, steps);
+    std::printf("    {\"case\": \"%s\", \"lanes\": %u, \"ns_per_sample\": %.3f}%s\n", name, F::kLanes, ns,
+                last ? "" : ",");
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    int32_t *raw = mitbih_load(path, 2, 0, &n);
+    if (raw == nullptr)
+    {
+        std::fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+    std::vector<int32_t> record(raw, raw + n);
+    std::free(raw);
+
+    /* Bit-exact against the C filter on the real record */
+    std::vector<int32_t> expected(n);
+    std::vector<int32_t> actual(n);
+    BandpassFilter c_filter;
+    BandpassFilter_Init(&c_filter);
+    BandpassFilter_ApplyBlock(&c_filter, record.data(), expected.data(), n);
+    Bandpass<200, 500, 40000> cpp_filter;
+    cpp_filter.apply_block(record.data(), actual.data(), n);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < n; i++)
+        mismatches += expected[i] != actual[i];
+
+    /* C reference timing */
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRepeat; r++)
+    {
+        BandpassFilter_Init(&c_filter);
+        BandpassFilter_ApplyBlock(&c_filter, record.data(), expected.data(), n);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double c_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (static_cast<double>(n) * kRepeat);
+
+    std::printf("{\n  \"benchmark\": \"bandpass_template\",\n  \"mismatches_vs_filter_c\": %zu,\n", mismatches);
+    std::printf("  \"filter_c_block_ns_per_sample\": %.3f,\n  \"results\": [\n", c_ns);
+    emit<Bandpass<200, 500, 40000>>("200Hz", record, false);
+    emit<Bandpass<200, 500, 40000, 2>>("200Hz", record, false);
+    emit<Bandpass<200, 500, 40000, 3>>("200Hz", record, false);
+    emit<Bandpass<200, 500, 40000, 8>>("200Hz", record, false);
+    emit<Bandpass<200, 500, 40000, 12>>("200Hz", record, false);
+    emit<Bandpass<250, 500, 40000>>("250Hz", record, false);
+    emit<Bandpass<360, 500, 40000>>("360Hz", record, false);
+    emit<Bandpass<500, 500, 40000>>("500Hz", record, false);
+    emit<Bandpass<500, 500, 40000, 8>>("500Hz", record, true);
+    std::printf("  ]\n}\n");
+
+    return mismatches ? 1 : 0;
+}
+
+/* End of file -------------------------------------------------------- */
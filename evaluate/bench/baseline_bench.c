@@ -0,0 +1,247 @@
+/**
+ * @file       baseline_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Residual baseline wander and cost of the multirate baseline
+ *             filter against full-rate alternatives, on record 100.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/baseline_bench.c evaluate/bench/mitbih.c
+ *                 Embedded/QRS_ECG/Core/Src/baseline.c -lm -o baseline_bench
+ *             ./baseline_bench [evaluate/data/100.dat]
+ *             The record is fed as the firmware's 200 Hz stream with
+ *             synthetic wander (0.05, 0.15 and 0.3 Hz) added. Residual is
+ *             the RMS output difference between the record with and without
+ *             wander after 4 s of settling, as a fraction of the wander RMS.
+ *             "highpass64" is the high-pass stage of BandpassFilter. Cost is
+ *             x86 TSC cycles per sample.
+ * @example    baseline_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "baseline.h"
+#include "mitbih.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_FS       (200.0) /*!< Firmware sample rate */
+#define BENCH_SETTLE   (800)   /*!< Samples skipped before measuring */
+#define BENCH_REPEAT   (5)     /*!< Passes over the record for cost */
+#define BENCH_FULL_WIN (601)   /*!< Full-rate window, same 3 s span */
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief Full-rate reference state, window of BENCH_FULL_WIN samples.
+ */
+typedef struct
+{
+    int32_t window[BENCH_FULL_WIN]; /**< Samples, oldest at index */
+    int32_t sorted[BENCH_FULL_WIN]; /**< Same samples ascending (median only) */
+    int64_t sum;                    /**< Running sum (mean only) */
+    uint32_t index;                 /**< Oldest sample */
+    int primed;                     /**< Seeded from the first sample */
+} bench_full_t;
+
+/**
+ * @brief One method under test.
+ */
+typedef struct
+{
+    const char *name;                                             /**< JSON name */
+    void (*run)(const int32_t *in, int32_t *out, size_t n);       /**< Whole-record runner */
+    size_t state_bytes;                                           /**< Filter state size */
+} bench_method_t;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Runners for each method.
+ *
+ * @attention  Internal functions, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void run_highpass64(const int32_t *in, int32_t *out, size_t n);
+static void run_multirate(const int32_t *in, int32_t *out, size_t n);
+static void run_full_mean(const int32_t *in, int32_t *out, size_t n);
+static void run_full_median(const int32_t *in, int32_t *out, size_t n);
+
+/**
+ * @brief  RMS of a - b from BENCH_SETTLE on.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - RMS difference
+ */
+static double rms_diff(const int32_t *a, const int32_t *b, size_t n);
+
+/* Private variables -------------------------------------------------- */
+static const bench_method_t methods[] = {
+    {"highpass64", run_highpass64, 64 * sizeof(int32_t)},
+    {"multirate_median", run_multirate, sizeof(BaselineFilter)},
+    {"full_rate_mean", run_full_mean, BENCH_FULL_WIN * sizeof(int32_t)},
+    {"full_rate_median", run_full_median, 2 * BENCH_FULL_WIN * sizeof(int32_t)},
+};
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    int32_t *record = mitbih_load(path, 2, 0, &n);
+    if (record == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    int32_t *clean = malloc(n * sizeof(int32_t));
+    int32_t *noisy = malloc(n * sizeof(int32_t));
+    int32_t *wander = malloc(n * sizeof(int32_t));
+    int32_t *out_clean = malloc(n * sizeof(int32_t));
+    int32_t *out_noisy = malloc(n * sizeof(int32_t));
+
+    for (size_t i = 0; i < n; i++)
+    {
+        double t = (double)i / BENCH_FS;
+        wander[i] = (int32_t)lrint(150.0 * sin(2.0 * M_PI * 0.05 * t) + 300.0 * sin(2.0 * M_PI * 0.15 * t) +
+                                   200.0 * sin(2.0 * M_PI * 0.3 * t + 1.0));
+        clean[i] = record[i] * 2;
+        noisy[i] = clean[i] + wander[i];
+    }
+    memset(out_clean, 0, n * sizeof(int32_t));
+    double wander_rms = rms_diff(wander, out_clean, n);
+
+    printf("{\n  \"benchmark\": \"baseline\",\n  \"samples\": %zu,\n  \"wander_rms\": %.1f,\n", n, wander_rms);
+    printf("  \"multirate_delay_samples\": %d,\n  \"results\": [\n", BASELINE_DELAY);
+
+    for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); m++)
+    {
+        methods[m].run(clean, out_clean, n);
+        methods[m].run(noisy, out_noisy, n);
+        double residual = rms_diff(out_noisy, out_clean, n);
+
+        int reps = (methods[m].run == run_full_median) ? 1 : BENCH_REPEAT;
+        uint64_t t0 = __rdtsc();
+        for (int r = 0; r < reps; r++)
+            methods[m].run(noisy, out_noisy, n);
+        double cost = (double)(__rdtsc() - t0) / ((double)n * reps);
+
+        printf("    {\"method\": \"%s\", \"residual_rms\": %.1f, \"residual_fraction\": %.3f, "
+               "\"cycles_per_sample\": %.2f, \"state_bytes\": %zu}%s\n",
+               methods[m].name, residual, residual / wander_rms, cost, methods[m].state_bytes,
+               (m + 1 < sizeof(methods) / sizeof(methods[0])) ? "," : "");
+    }
+    printf("  ]\n}\n");
+
+    free(record);
+    free(clean);
+    free(noisy);
+    free(wander);
+    free(out_clean);
+    free(out_noisy);
+    return 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void run_highpass64(const int32_t *in, int32_t *out, size_t n)
+{
+    /* Same arithmetic as the high-pass half of BandpassFilter */
+    int32_t buffer[64] = {0};
+    int32_t sum = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        sum += in[i] - buffer[i & 63];
+        buffer[i & 63] = in[i];
+        out[i] = in[i] - (sum >> 7);
+    }
+}
+
+static void run_multirate(const int32_t *in, int32_t *out, size_t n)
+{
+    static BaselineFilter filter;
+    BaselineFilter_Init(&filter);
+    BaselineFilter_ApplyBlock(&filter, in, out, n);
+}
+
+static void run_full_mean(const int32_t *in, int32_t *out, size_t n)
+{
+    static bench_full_t st;
+    const uint32_t half = BENCH_FULL_WIN / 2;
+    memset(&st, 0, sizeof(st));
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!st.primed)
+        {
+            for (uint32_t k = 0; k < BENCH_FULL_WIN; k++)
+                st.window[k] = in[0];
+            st.sum = (int64_t)in[0] * BENCH_FULL_WIN;
+            st.primed = 1;
+        }
+        st.sum += in[i] - st.window[st.index];
+        st.window[st.index] = in[i];
+        if (++st.index == BENCH_FULL_WIN)
+            st.index = 0;
+        /* Centre of the window is half samples back */
+        int32_t centre = st.window[(st.index + half) % BENCH_FULL_WIN];
+        out[i] = centre - (int32_t)(st.sum / BENCH_FULL_WIN);
+    }
+}
+
+static void run_full_median(const int32_t *in, int32_t *out, size_t n)
+{
+    static bench_full_t st;
+    const uint32_t half = BENCH_FULL_WIN / 2;
+    memset(&st, 0, sizeof(st));
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!st.primed)
+        {
+            for (uint32_t k = 0; k < BENCH_FULL_WIN; k++)
+                st.window[k] = st.sorted[k] = in[0];
+            st.primed = 1;
+        }
+        int32_t oldest = st.window[st.index];
+        int32_t x = in[i];
+        st.window[st.index] = x;
+        if (++st.index == BENCH_FULL_WIN)
+            st.index = 0;
+
+        uint32_t k = 0;
+        while (st.sorted[k] != oldest)
+            k++;
+        if (x > oldest)
+            for (; k + 1 < BENCH_FULL_WIN && st.sorted[k + 1] < x; k++)
+                st.sorted[k] = st.sorted[k + 1];
+        else
+            for (; k > 0 && st.sorted[k - 1] > x; k--)
+                st.sorted[k] = st.sorted[k - 1];
+        st.sorted[k] = x;
+
+        int32_t centre = st.window[(st.index + half) % BENCH_FULL_WIN];
+        out[i] = centre - st.sorted[half];
+    }
+}
+
+static double rms_diff(const int32_t *a, const int32_t *b, size_t n)
+{
+    double sum = 0;
+    for (size_t i = BENCH_SETTLE; i < n; i++)
+    {
+        double d = (double)a[i] - (double)b[i];
+        sum += d * d;
+    }
+    return sqrt(sum / (double)(n - BENCH_SETTLE));
+}
+
+/* End of file -------------------------------------------------------- */
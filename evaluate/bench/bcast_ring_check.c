@@ -0,0 +1,213 @@
+/**
+ * @file       bcast_ring_check.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host checks for the broadcast ring with a fast and a slow
+ *             reader.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/bcast_ring_check.c
+ *                 Embedded/QRS_ECG/Core/Src/bcast_ring.c -o bcast_ring_check
+ *             ./bcast_ring_check
+ *             The writer pushes a counting sequence in bursts of 1 to 8
+ *             elements into a 64-element ring. The fast reader drains after
+ *             every burst, the slow reader reads 16 elements every 20
+ *             bursts. Both run interleaved in one thread, which is the
+ *             single-core model the ring is written for.
+ *             overwrite: the fast reader must get every element in order
+ *             with no loss; the slow reader must be overrun, resume at the
+ *             oldest element still stored, and its skips must add up to
+ *             lost. drop_new: the writer is held back by the slow reader,
+ *             refused counts what it turned away, and both readers get
+ *             every accepted element in order.
+ *             Exit status is 0 when every check passes.
+ * @example    bcast_ring_check.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "bcast_ring.h"
+#include <stdio.h>
+
+/* Private defines ---------------------------------------------------- */
+#define CHECK_COUNT      (64)    /*!< Ring elements, power of two */
+#define CHECK_BURSTS     (20000) /*!< Writer bursts per case */
+#define CHECK_MAX_BURST  (8)     /*!< Largest burst */
+#define CHECK_SLOW_EVERY (20)    /*!< Bursts between slow reader reads */
+#define CHECK_SLOW_READ  (16)    /*!< Elements per slow reader read */
+
+/* Private macros ----------------------------------------------------- */
+/**
+ * @brief  Count a failed condition and report where it happened.
+ */
+#define CHECK(cond)                                                                 \
+    do                                                                              \
+    {                                                                               \
+        if (!(cond))                                                                \
+        {                                                                           \
+            failures++;                                                             \
+            if (failures <= 10)                                                     \
+                fprintf(stderr, "%s:%d: %s failed\n", __func__, __LINE__, #cond);  \
+        }                                                                           \
+    } while (0)
+
+/* Private variables -------------------------------------------------- */
+static uint32_t failures;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Fast and slow reader on an overwriting ring.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_overwrite(void);
+
+/**
+ * @brief  Fast and slow reader on a drop-new ring.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_drop_new(void);
+
+/* Function definitions ----------------------------------------------- */
+int main(void)
+{
+    check_overwrite();
+    check_drop_new();
+
+    printf("%u failures\n", failures);
+    return failures ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void check_overwrite(void)
+{
+    static uint32_t storage[CHECK_COUNT];
+    uint32_t burst[CHECK_MAX_BURST];
+    uint32_t out[CHECK_COUNT];
+    bcast_ring_t ring;
+    uint32_t next = 0;      /* Next sequence value to write */
+    uint32_t fast_next = 0; /* Next value the fast reader expects */
+    uint32_t slow_next = 0; /* Next value the slow reader expects */
+    uint32_t skipped = 0;   /* Elements the slow reader jumped over */
+    uint32_t skips = 0;     /* Reads that started with a jump */
+    uint32_t seed = 11;
+
+    CHECK(bcast_init(&ring, storage, CHECK_COUNT, sizeof(uint32_t), CB_POLICY_OVERWRITE) == BCAST_SUCCESS);
+    uint32_t fast = bcast_attach(&ring);
+    uint32_t slow = bcast_attach(&ring);
+    CHECK(fast != BCAST_ERROR && slow != BCAST_ERROR && fast != slow);
+
+    for (uint32_t b = 0; b < CHECK_BURSTS; b++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        uint32_t n = 1 + (seed >> 24) % CHECK_MAX_BURST;
+        for (uint32_t i = 0; i < n; i++)
+            burst[i] = next + i;
+        CHECK(bcast_write(&ring, burst, n) == n);
+        next += n;
+
+        /* Fast reader: never more than one burst behind */
+        CHECK(bcast_lag(&ring, fast) == n);
+        uint32_t got = bcast_read(&ring, fast, out, CHECK_COUNT);
+        CHECK(got == n);
+        for (uint32_t i = 0; i < got; i++, fast_next++)
+            CHECK(out[i] == fast_next);
+
+        if (b % CHECK_SLOW_EVERY != CHECK_SLOW_EVERY - 1)
+            continue;
+
+        /* Slow reader: after an overrun it resumes at the oldest stored
+           element, then the read is contiguous */
+        uint32_t behind = bcast_lag(&ring, slow);
+        got = bcast_read(&ring, slow, out, CHECK_SLOW_READ);
+        CHECK(got == CHECK_SLOW_READ);
+        if (behind > CHECK_COUNT)
+        {
+            CHECK(out[0] == next - CHECK_COUNT);
+            skipped += out[0] - slow_next;
+            skips++;
+        }
+        else
+        {
+            CHECK(out[0] == slow_next);
+        }
+        for (uint32_t i = 0; i < got; i++)
+            CHECK(out[i] == out[0] + i);
+        slow_next = out[0] + got;
+    }
+
+    CHECK(ring.readers[fast].lost == 0 && ring.readers[fast].overruns == 0);
+    CHECK(fast_next == next);
+    CHECK(skips > 0 && ring.readers[slow].overruns == skips);
+    CHECK(skipped > 0 && ring.readers[slow].lost == skipped);
+    printf("overwrite: %u written, fast lost %u, slow lost %u in %u overruns\n", next,
+           ring.readers[fast].lost, ring.readers[slow].lost, ring.readers[slow].overruns);
+}
+
+static void check_drop_new(void)
+{
+    static uint32_t storage[CHECK_COUNT];
+    uint32_t burst[CHECK_MAX_BURST];
+    uint32_t out[CHECK_COUNT];
+    bcast_ring_t ring;
+    uint32_t next = 0;      /* Next sequence value to write */
+    uint32_t turned = 0;    /* Elements the writer could not place */
+    uint32_t fast_next = 0; /* Next value the fast reader expects */
+    uint32_t slow_next = 0; /* Next value the slow reader expects */
+    uint32_t seed = 13;
+
+    CHECK(bcast_init(&ring, storage, CHECK_COUNT, sizeof(uint32_t), CB_POLICY_DROP_NEW) == BCAST_SUCCESS);
+    uint32_t fast = bcast_attach(&ring);
+    uint32_t slow = bcast_attach(&ring);
+
+    for (uint32_t b = 0; b < CHECK_BURSTS; b++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        uint32_t n = 1 + (seed >> 24) % CHECK_MAX_BURST;
+        for (uint32_t i = 0; i < n; i++)
+            burst[i] = next + i;
+        uint32_t written = bcast_write(&ring, burst, n);
+        CHECK(written <= n);
+        next += written;
+        turned += n - written;
+
+        /* The slowest reader bounds the writer */
+        CHECK(bcast_lag(&ring, slow) <= CHECK_COUNT);
+
+        uint32_t got = bcast_read(&ring, fast, out, CHECK_COUNT);
+        for (uint32_t i = 0; i < got; i++, fast_next++)
+            CHECK(out[i] == fast_next);
+
+        if (b % CHECK_SLOW_EVERY == CHECK_SLOW_EVERY - 1)
+        {
+            got = bcast_read(&ring, slow, out, CHECK_SLOW_READ);
+            for (uint32_t i = 0; i < got; i++, slow_next++)
+                CHECK(out[i] == slow_next);
+        }
+    }
+
+    /* Drain the slow reader, it must still have every accepted element */
+    uint32_t got = 0;
+    while ((got = bcast_read(&ring, slow, out, CHECK_COUNT)) > 0)
+        for (uint32_t i = 0; i < got; i++, slow_next++)
+            CHECK(out[i] == slow_next);
+
+    CHECK(turned > 0 && ring.refused == turned);
+    CHECK(fast_next == next && slow_next == next);
+    CHECK(ring.readers[fast].lost == 0 && ring.readers[slow].lost == 0);
+    CHECK(ring.readers[fast].overruns == 0 && ring.readers[slow].overruns == 0);
+    printf("drop_new: %u written, %u refused, no reader lost data\n", next, ring.refused);
+}
+
+/* End of file -------------------------------------------------------- */
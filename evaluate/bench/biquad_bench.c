@@ -0,0 +1,209 @@
+/**
+ * @file       biquad_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Frequency response and throughput of the biquad cascade
+ *             against the moving-average Bandpass Filter.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/biquad_bench.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c
+ *                 Embedded/QRS_ECG/Core/Src/biquad.c -lm -o biquad_bench
+ *             ./biquad_bench [evaluate/data/100.dat]
+ *             Gains come from the steady-state RMS of a 1000-count sine.
+ *             Cost is x86 TSC cycles per sample on record 100.
+ * @example    biquad_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "biquad.h"
+#include "biquad_coeffs.h"
+#include "filter.h"
+#include "mitbih.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_AMPLITUDE (1000.0) /*!< Test tone amplitude in ADC counts */
+#define BENCH_SECONDS   (60)     /*!< Tone length, first half is settling */
+#define BENCH_Q31_SHIFT (16)     /*!< 12-bit ADC counts to Q31 */
+#define BENCH_Q15_SHIFT (2)      /*!< 12-bit ADC counts to Q15, 2 bits headroom */
+#define BENCH_REPEAT    (20)     /*!< Passes over the record for cost */
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief Coefficient set for one sample rate.
+ */
+typedef struct
+{
+    int fs;               /**< Sample rate in Hz */
+    const int32_t *q31;   /**< Q31 coefficients */
+    uint8_t q31_shift;    /**< Q31 headroom bits */
+    const int16_t *q15;   /**< Q15 coefficients */
+    uint8_t q15_shift;    /**< Q15 headroom bits */
+} bench_rate_t;
+
+/* Private variables -------------------------------------------------- */
+static const bench_rate_t rates[] = {
+    {200, biquad_bp_200hz_q31, BIQUAD_BP_200HZ_Q31_SHIFT, biquad_bp_200hz_q15, BIQUAD_BP_200HZ_Q15_SHIFT},
+    {250, biquad_bp_250hz_q31, BIQUAD_BP_250HZ_Q31_SHIFT, biquad_bp_250hz_q15, BIQUAD_BP_250HZ_Q15_SHIFT},
+    {360, biquad_bp_360hz_q31, BIQUAD_BP_360HZ_Q31_SHIFT, biquad_bp_360hz_q15, BIQUAD_BP_360HZ_Q15_SHIFT},
+    {500, biquad_bp_500hz_q31, BIQUAD_BP_500HZ_Q31_SHIFT, biquad_bp_500hz_q15, BIQUAD_BP_500HZ_Q15_SHIFT},
+};
+static const double tones[] = {0.0, 0.1, 0.25, 0.5, 1.0, 5.0, 10.0, 20.0, 40.0, 50.0, 60.0, 80.0};
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Gain in dB of one filter for a tone, 0 Hz means a DC step.
+ *
+ * @param[in]  kind  0: moving average, 1: biquad Q31, 2: biquad Q15.
+ * @param[in]  rate  Coefficient set.
+ * @param[in]  hz    Tone frequency.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Gain in dB
+ */
+static double bench_gain(int kind, const bench_rate_t *rate, double hz);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    int32_t *record = mitbih_load(path, 2, 0, &n);
+    if (record == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    printf("{\n  \"benchmark\": \"biquad\",\n  \"band_hz\": [%g, %g],\n  \"stages\": %d,\n",
+           BIQUAD_BP_LOW_HZ, BIQUAD_BP_HIGH_HZ, BIQUAD_BP_STAGES);
+
+    /* Frequency response, the moving average only exists for 200 Hz */
+    printf("  \"response_db\": [\n");
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        for (size_t t = 0; t < sizeof(tones) / sizeof(tones[0]); t++)
+        {
+            if (tones[t] >= rates[r].fs / 2.0)
+                continue;
+            printf("%s    {\"fs\": %d, \"hz\": %g, \"biquad_q31\": %.2f, \"biquad_q15\": %.2f",
+                   (r == 0 && t == 0) ? "" : ",\n", rates[r].fs, tones[t],
+                   bench_gain(1, &rates[r], tones[t]), bench_gain(2, &rates[r], tones[t]));
+            if (rates[r].fs == 200)
+                printf(", \"moving_average\": %.2f", bench_gain(0, &rates[r], tones[t]));
+            printf("}");
+        }
+    }
+    printf("\n  ],\n");
+
+    /* Cost per sample on record 100 at 12-bit scale */
+    int32_t *in32 = malloc(n * sizeof(int32_t));
+    int32_t *out32 = malloc(n * sizeof(int32_t));
+    int16_t *in16 = malloc(n * sizeof(int16_t));
+    int16_t *out16 = malloc(n * sizeof(int16_t));
+    BandpassFilter filter;
+    BiquadQ31 q31;
+    BiquadQ15 q15;
+    BiquadStateQ31 q31_state[BIQUAD_BP_STAGES];
+    BiquadStateQ15 q15_state[BIQUAD_BP_STAGES];
+    uint64_t t0 = 0;
+    double cost[3];
+
+    for (size_t i = 0; i < n; i++)
+        in32[i] = (record[i] - 1024) * 2;
+
+    t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilter_Init(&filter);
+        BandpassFilter_ApplyBlock(&filter, in32, out32, n);
+    }
+    cost[0] = (double)(__rdtsc() - t0) / ((double)n * BENCH_REPEAT);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        in16[i] = (int16_t)(in32[i] << BENCH_Q15_SHIFT);
+        in32[i] <<= BENCH_Q31_SHIFT;
+    }
+
+    t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BiquadQ31_Init(&q31, biquad_bp_200hz_q31, q31_state, BIQUAD_BP_STAGES, BIQUAD_BP_200HZ_Q31_SHIFT);
+        BiquadQ31_ApplyBlock(&q31, in32, out32, n);
+    }
+    cost[1] = (double)(__rdtsc() - t0) / ((double)n * BENCH_REPEAT);
+
+    t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BiquadQ15_Init(&q15, biquad_bp_200hz_q15, q15_state, BIQUAD_BP_STAGES, BIQUAD_BP_200HZ_Q15_SHIFT);
+        BiquadQ15_ApplyBlock(&q15, in16, out16, n);
+    }
+    cost[2] = (double)(__rdtsc() - t0) / ((double)n * BENCH_REPEAT);
+
+    printf("  \"tsc_cycles_per_sample\": {\"moving_average_block\": %.2f, \"biquad_q31_block\": %.2f, "
+           "\"biquad_q15_block\": %.2f}\n}\n", cost[0], cost[1], cost[2]);
+
+    free(record);
+    free(in32);
+    free(out32);
+    free(in16);
+    free(out16);
+    return 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static double bench_gain(int kind, const bench_rate_t *rate, double hz)
+{
+    const size_t n = (size_t)rate->fs * BENCH_SECONDS;
+    BandpassFilter filter;
+    BiquadQ31 q31;
+    BiquadQ15 q15;
+    BiquadStateQ31 q31_state[BIQUAD_BP_STAGES];
+    BiquadStateQ15 q15_state[BIQUAD_BP_STAGES];
+    double in_power = 0;
+    double out_power = 0;
+
+    BandpassFilter_Init(&filter);
+    BiquadQ31_Init(&q31, rate->q31, q31_state, BIQUAD_BP_STAGES, rate->q31_shift);
+    BiquadQ15_Init(&q15, rate->q15, q15_state, BIQUAD_BP_STAGES, rate->q15_shift);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        double x = (hz == 0.0) ? BENCH_AMPLITUDE : BENCH_AMPLITUDE * sin(2.0 * M_PI * hz * i / rate->fs);
+        int32_t xi = (int32_t)lround(x);
+        double y = 0;
+
+        if (kind == 0)
+            y = BandpassFilter_Apply(&filter, xi);
+        else if (kind == 1)
+            y = ldexp(BiquadQ31_Apply(&q31, xi * (1 << BENCH_Q31_SHIFT)), -BENCH_Q31_SHIFT);
+        else
+            y = ldexp(BiquadQ15_Apply(&q15, (int16_t)(xi * (1 << BENCH_Q15_SHIFT))), -BENCH_Q15_SHIFT);
+
+        if (i >= n / 2)
+        {
+            in_power += (double)xi * xi;
+            out_power += y * y;
+        }
+    }
+
+    return 10.0 * log10((out_power + 1e-9) / in_power);
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,343 @@
+/**
+ * @file       cbuffer_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host benchmark for the firmware Circular Buffer.
+ *             Measures cb_write/cb_read across buffer, element and chunk
+ *             sizes in a single thread, plus the same sizes through
+ *             spsc_ring on two threads, and prints JSON.
+ *
+ * @note       Build and run on x86-64 Linux from the repository root:
+ *             gcc -O2 -pthread -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/cbuffer_bench.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c
+ *                 Embedded/QRS_ECG/Core/Src/spsc_ring.c -o cbuffer_bench
+ *             ./cbuffer_bench [--quick] [--label NAME] > result.json
+ *             cbuffer_t has no cross-thread ordering, so the two-thread
+ *             mode runs on spsc_ring with the same storage and element
+ *             size ("spsc_producer_consumer"). NAME goes into the JSON as
+ *             is and may not contain quotes, backslashes or control
+ *             characters.
+ * @example    cbuffer_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#define _GNU_SOURCE
+#include "cbuffer.h"
+#include "spsc_ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_MIN_BYTES (64u << 20) /*!< Bytes moved per single thread case */
+#define BENCH_PC_BYTES  (256u << 20) /*!< Bytes moved per producer/consumer case */
+#define BENCH_MAX_CHUNK (4096u)     /*!< Largest chunk used by any case */
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief Producer/consumer thread context.
+ */
+typedef struct
+{
+    spsc_ring_t *ring; /**< Shared ring */
+    uint32_t chunk;    /**< Elements per call */
+    uint64_t total;    /**< Elements to move */
+    uint64_t calls;    /**< Calls that moved data */
+} bench_side_t;
+
+/* Private variables -------------------------------------------------- */
+static const uint32_t buffer_sizes[] = {256, 4096, 65536, 1u << 20, CB_MAX_SIZE};
+static const uint32_t elem_sizes[] = {1, 4, 16};
+static const uint32_t chunk_sizes[] = {1, 4, 16, 64, 256, 1024, 4096};
+
+static uint8_t src_block[BENCH_MAX_CHUNK];
+static uint8_t dst_block[BENCH_MAX_CHUNK];
+static volatile uint32_t sink;
+static int first_result = 1;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/**
+ * @brief  Run one single thread case: fill half the buffer, drain it, repeat.
+ *
+ * @param[in]  size   Buffer size in bytes.
+ * @param[in]  elem   Element size in bytes.
+ * @param[in]  chunk  Bytes per cb_write/cb_read call.
+ * @param[in]  total  Bytes to move.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_single(uint32_t size, uint32_t elem, uint32_t chunk, uint64_t total);
+
+/**
+ * @brief  Run one producer/consumer case on two threads through spsc_ring.
+ *
+ * @param[in]  size   Storage size in bytes.
+ * @param[in]  elem   Element size in bytes.
+ * @param[in]  chunk  Bytes per spsc_write/spsc_read call.
+ * @param[in]  total  Bytes to move.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_pc(uint32_t size, uint32_t elem, uint32_t chunk, uint64_t total);
+
+/**
+ * @brief  Producer thread body.
+ *
+ * @param[inout]  arg  Pointer to a bench_side_t structure.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - NULL
+ */
+static void *bench_producer(void *arg);
+
+/**
+ * @brief  Consumer thread body.
+ *
+ * @param[inout]  arg  Pointer to a bench_side_t structure.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - NULL
+ */
+static void *bench_consumer(void *arg);
+
+/**
+ * @brief  Check that a label can be printed inside a JSON string as is.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - (1): Label is safe
+ *  - (0): Label has a quote, backslash or control character
+ */
+static int bench_label_ok(const char *label);
+
+/**
+ * @brief  Print one JSON result object.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_emit(const char *mode, uint32_t size, uint32_t elem, uint32_t chunk,
+                       double write_ns, double read_ns, uint64_t bytes, uint64_t elapsed_ns);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *label = "";
+    int quick = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--quick") == 0)
+            quick = 1;
+        else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc)
+            label = argv[++i];
+    }
+
+    if (!bench_label_ok(label))
+    {
+        fprintf(stderr, "--label may not contain quotes, backslashes or control characters\n");
+        return 2;
+    }
+
+    for (uint32_t i = 0; i < sizeof(src_block); i++)
+        src_block[i] = (uint8_t)i;
+
+    printf("{\n  \"benchmark\": \"cbuffer\",\n  \"label\": \"%s\",\n", label);
+    printf("  \"cb_max_size\": %u,\n  \"results\": [\n", CB_MAX_SIZE);
+
+    for (size_t b = 0; b < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); b++)
+    {
+        for (size_t e = 0; e < sizeof(elem_sizes) / sizeof(elem_sizes[0]); e++)
+        {
+            for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+            {
+                uint32_t size = buffer_sizes[b];
+                uint32_t elem = elem_sizes[e];
+                uint32_t chunk = chunk_sizes[c];
+                if (chunk < elem || chunk % elem != 0 || chunk > size / 2)
+                    continue;
+
+                /* Keep tiny chunks affordable, they are dominated by call cost */
+                uint64_t total = (uint64_t)BENCH_MIN_BYTES * chunk / (chunk + 64);
+                if (quick)
+                    total /= 16;
+                bench_single(size, elem, chunk, total);
+
+                total = (uint64_t)BENCH_PC_BYTES * chunk / (chunk + 64);
+                if (quick)
+                    total /= 16;
+                bench_pc(size, elem, chunk, total);
+            }
+        }
+    }
+
+    printf("\n  ]\n}\n");
+    return 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void bench_single(uint32_t size, uint32_t elem, uint32_t chunk, uint64_t total)
+{
+    cbuffer_t cb;
+    uint8_t *storage = malloc(size);
+    uint32_t batch = (size / 2) / chunk;
+    uint64_t moved = 0;
+    uint64_t writes = 0;
+    uint64_t reads = 0;
+    uint64_t write_ns = 0;
+    uint64_t read_ns = 0;
+    uint64_t t0 = 0;
+
+    if (storage == NULL || cb_init_elem(&cb, storage, size, elem, CB_POLICY_DROP_NEW) != CB_SUCCESS)
+    {
+        free(storage);
+        return;
+    }
+
+    while (moved < total)
+    {
+        t0 = bench_now();
+        for (uint32_t i = 0; i < batch; i++)
+            sink += cb_write(&cb, src_block, chunk);
+        write_ns += bench_now() - t0;
+        writes += batch;
+
+        t0 = bench_now();
+        for (uint32_t i = 0; i < batch; i++)
+            sink += cb_read(&cb, dst_block, chunk);
+        read_ns += bench_now() - t0;
+        reads += batch;
+
+        moved += (uint64_t)batch * chunk;
+    }
+
+    bench_emit("single", size, elem, chunk, (double)write_ns / writes, (double)read_ns / reads,
+               moved, write_ns + read_ns);
+    free(storage);
+}
+
+static void bench_pc(uint32_t size, uint32_t elem, uint32_t chunk, uint64_t total)
+{
+    spsc_ring_t *ring = aligned_alloc(SPSC_CACHE_LINE, sizeof(spsc_ring_t));
+    pthread_t producer;
+    pthread_t consumer;
+    bench_side_t prod = {ring, chunk / elem, total / elem, 0};
+    bench_side_t cons = {ring, chunk / elem, total / elem, 0};
+    uint8_t *storage = malloc(size);
+    uint64_t t0 = 0;
+    uint64_t elapsed = 0;
+
+    if (ring == NULL || storage == NULL || spsc_init(ring, storage, size / elem, elem) != SPSC_SUCCESS)
+    {
+        free(ring);
+        free(storage);
+        return;
+    }
+
+    t0 = bench_now();
+    pthread_create(&consumer, NULL, bench_consumer, &cons);
+    pthread_create(&producer, NULL, bench_producer, &prod);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    elapsed = bench_now() - t0;
+
+    /* Both sides run concurrently, so per-call cost is wall time per call */
+    bench_emit("spsc_producer_consumer", size, elem, chunk, (double)elapsed / prod.calls,
+               (double)elapsed / cons.calls, prod.total * elem, elapsed);
+    free(ring);
+    free(storage);
+}
+
+static void *bench_producer(void *arg)
+{
+    bench_side_t *side = arg;
+    uint64_t done = 0;
+    while (done < side->total)
+    {
+        uint32_t n = spsc_write(side->ring, src_block, side->chunk);
+        if (n == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        done += n;
+        side->calls++;
+    }
+
+    return NULL;
+}
+
+static void *bench_consumer(void *arg)
+{
+    bench_side_t *side = arg;
+    uint64_t done = 0;
+    while (done < side->total)
+    {
+        uint32_t n = spsc_read(side->ring, dst_block, side->chunk);
+        if (n == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        done += n;
+        side->calls++;
+    }
+
+    return NULL;
+}
+
+static int bench_label_ok(const char *label)
+{
+    for (const unsigned char *c = (const unsigned char *)label; *c != '\0'; c++)
+        if (*c == '"' || *c == '\\' || *c < 0x20)
+            return 0;
+
+    return 1;
+}
+
+static void bench_emit(const char *mode, uint32_t size, uint32_t elem, uint32_t chunk,
+                       double write_ns, double read_ns, uint64_t bytes, uint64_t elapsed_ns)
+{
+    printf("%s    {\"mode\": \"%s\", \"buffer_bytes\": %u, \"elem_bytes\": %u, \"chunk_bytes\": %u, "
+           "\"write_ns_per_op\": %.2f, \"read_ns_per_op\": %.2f, \"bytes\": %llu, \"bytes_per_s\": %.0f}",
+           first_result ? "" : ",\n", mode, size, elem, chunk, write_ns, read_ns,
+           (unsigned long long)bytes, elapsed_ns ? (double)bytes * 1e9 / elapsed_ns : 0.0);
+    first_result = 0;
+    fflush(stdout);
+}
+
+/* End of file -------------------------------------------------------- */
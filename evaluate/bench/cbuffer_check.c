@@ -0,0 +1,470 @@
+/**
+ * @file       cbuffer_check.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host checks for the firmware Circular Buffer.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/cbuffer_check.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o cbuffer_check
+ *             ./cbuffer_check
+ *             wraparound: writer and reader are seeded just below 2^32 and
+ *             random writes and reads run across the wrap under both
+ *             policies. Every call is compared with a 64-bit model of the
+ *             stream: count, space, returned length, bytes and dropped.
+ *             zero_copy: data and free space are placed across the array
+ *             end, then peek/consume and reserve/commit walk both segments
+ *             on a power-of-two and a wrap-at-size buffer. Also checks the
+ *             error returns: consuming or committing too much, a partial
+ *             element, and cb_consume after the writer overwrote the
+ *             peeked data.
+ *             watermark: a simulated TIM2 ISR writes one 4-byte record per
+ *             tick, half through cb_write and half through
+ *             cb_reserve/cb_commit, into a 1024-record buffer with the
+ *             frame watermark from main.c. A main loop wakes after a
+ *             random number of ticks, sometimes long enough to overflow,
+ *             and drains frames with peek/consume the way main.c does,
+ *             with ticks landing between peek and consume. The callback
+ *             count must rise by exactly one on each write that takes the
+ *             modelled level from below the watermark to at or above it,
+ *             and never on a read, consume or drain.
+ *             Exit status is 0 when every check passes.
+ * @example    cbuffer_check.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "cbuffer.h"
+
+/* Private defines ---------------------------------------------------- */
+#define CHECK_SIZE     (256)         /*!< Buffer size, power of two */
+#define CHECK_SEED_POS (0xFFFFFF00u) /*!< Start index, 256 bytes below 2^32 */
+#define CHECK_OPS      (4000)        /*!< Random operations per case */
+#define CHECK_MAX_IO   (96)          /*!< Largest random transfer */
+#define CHECK_RECORDS  (1024)        /*!< Watermark buffer, records of 4 bytes */
+#define CHECK_FRAME    (64)          /*!< Records per frame, FRAME_SAMPLES */
+#define CHECK_TICKS    (400000)      /*!< ISR ticks per watermark case */
+
+/* Private macros ----------------------------------------------------- */
+/**
+ * @brief  Count a failed condition and report where it happened.
+ */
+#define CHECK(cond)                                                                 \
+    do                                                                              \
+    {                                                                               \
+        if (!(cond))                                                                \
+        {                                                                           \
+            failures++;                                                             \
+            if (failures <= 10)                                                     \
+                fprintf(stderr, "%s:%d: %s failed\n", __func__, __LINE__, #cond);  \
+        }                                                                           \
+    } while (0)
+
+/* Private variables -------------------------------------------------- */
+static uint32_t failures;
+static uint32_t wm_fires;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Byte at a given position of the test stream.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Stream byte
+ */
+static uint8_t check_byte(uint64_t pos);
+
+/**
+ * @brief  Random writes and reads across the 2^32 index wrap.
+ *
+ * @param[in]  policy  Buffer policy under test.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_wraparound(cb_policy_t policy);
+
+/**
+ * @brief  Peek/consume and reserve/commit over both segments of a wrap.
+ *
+ * @param[in]  size  Buffer size, power of two or not.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_zero_copy(uint32_t size);
+
+/**
+ * @brief  cb_consume after the writer overwrote peeked data.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_consume_overwritten(void);
+
+/**
+ * @brief  Watermark callback: count calls.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_on_watermark(void *arg);
+
+/**
+ * @brief  One ISR tick: write one record and check the callback count.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_tick(cbuffer_t *cb, uint64_t *written, uint64_t *read, uint32_t *expected);
+
+/**
+ * @brief  Watermark at ISR cadence with main.c style drains.
+ *
+ * @param[in]  policy  Buffer policy under test.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void check_watermark(cb_policy_t policy);
+
+/* Function definitions ----------------------------------------------- */
+int main(void)
+{
+    check_wraparound(CB_POLICY_DROP_NEW);
+    check_wraparound(CB_POLICY_OVERWRITE);
+    check_zero_copy(64);
+    check_zero_copy(60);
+    check_consume_overwritten();
+    check_watermark(CB_POLICY_DROP_NEW);
+    check_watermark(CB_POLICY_OVERWRITE);
+
+    printf("%u failures\n", failures);
+    return failures ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint8_t check_byte(uint64_t pos)
+{
+    return (uint8_t)(pos * 131 + (pos >> 8) + 7);
+}
+
+static void check_wraparound(cb_policy_t policy)
+{
+    static uint8_t storage[CHECK_SIZE];
+    uint8_t io[CHECK_MAX_IO];
+    cbuffer_t cb;
+    cb_stats_t stats;
+    uint64_t written = 0; /* Stream bytes written so far */
+    uint64_t read = 0;    /* Stream position of the oldest stored byte */
+    uint64_t lost = 0;    /* Bytes the model dropped */
+    uint32_t seed = 7;
+    int wrapped = 0;
+
+    CHECK(cb_init(&cb, storage, CHECK_SIZE, policy) == CB_SUCCESS);
+    cb.writer = CHECK_SEED_POS;
+    cb.reader = CHECK_SEED_POS;
+
+    for (int op = 0; op < CHECK_OPS; op++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        uint32_t n = (seed >> 8) % (CHECK_MAX_IO + 1);
+
+        /* Writes twice as likely early on so the buffer fills and overflows */
+        if ((seed >> 28) < (op < CHECK_OPS / 2 ? 10u : 8u))
+        {
+            uint32_t space = CHECK_SIZE - (uint32_t)(written - read);
+            uint32_t expected = n;
+            if (policy == CB_POLICY_DROP_NEW && n > space)
+            {
+                expected = space;
+                lost += n - space;
+            }
+
+            for (uint32_t i = 0; i < n; i++)
+                io[i] = check_byte(written + i);
+            CHECK(cb_write(&cb, io, n) == expected);
+
+            written += expected;
+            if (written - read > CHECK_SIZE)
+            {
+                lost += written - read - CHECK_SIZE;
+                read = written - CHECK_SIZE;
+            }
+        }
+        else
+        {
+            uint32_t expected = (uint32_t)(written - read);
+            if (expected > n)
+                expected = n;
+
+            memset(io, 0, sizeof(io));
+            CHECK(cb_read(&cb, io, n) == expected);
+            for (uint32_t i = 0; i < expected; i++)
+                CHECK(io[i] == check_byte(read + i));
+            read += expected;
+        }
+
+        CHECK(cb_data_count(&cb) == (uint32_t)(written - read));
+        CHECK(cb_space_count(&cb) == CHECK_SIZE - (uint32_t)(written - read));
+        CHECK(cb_get_stats(&cb, &stats) == CB_SUCCESS && stats.dropped == lost);
+        if (cb.writer < CHECK_SEED_POS)
+            wrapped = 1;
+    }
+
+    /* The run must actually have crossed 2^32 with both indices */
+    CHECK(wrapped && cb.reader < CHECK_SEED_POS);
+    printf("wraparound %s: %llu bytes written, %llu dropped, writer 0x%08X reader 0x%08X\n",
+           policy == CB_POLICY_DROP_NEW ? "drop_new" : "overwrite", (unsigned long long)written,
+           (unsigned long long)lost, cb.writer, cb.reader);
+}
+
+static void check_zero_copy(uint32_t size)
+{
+    static uint8_t storage[64];
+    uint8_t io[64];
+    cbuffer_t cb;
+    void *ptr = NULL;
+    uint32_t n = 0;
+    uint64_t pos = 0;
+    const uint32_t capacity = (size & (size - 1)) == 0 ? size : size - 1;
+
+    CHECK(cb_init(&cb, storage, size, CB_POLICY_DROP_NEW) == CB_SUCCESS);
+
+    /* Move both indices to 40 so the next data crosses the array end */
+    for (uint32_t i = 0; i < 40; i++)
+        io[i] = check_byte(i);
+    CHECK(cb_write(&cb, io, 40) == 40);
+    CHECK(cb_read(&cb, io, 40) == 40);
+    pos = 40;
+
+    /* Reserve: first segment up to the array end, then the wrapped part */
+    n = cb_reserve(&cb, &ptr);
+    CHECK(ptr == storage + 40 && n == size - 40);
+    for (uint32_t i = 0; i < n; i++)
+        ((uint8_t *)ptr)[i] = check_byte(pos + i);
+    CHECK(cb_commit(&cb, n) == CB_SUCCESS);
+
+    n = cb_reserve(&cb, &ptr);
+    CHECK(ptr == storage && n == capacity - (size - 40));
+    CHECK(cb_commit(&cb, n + 1) == CB_ERROR);
+    for (uint32_t i = 0; i < 16; i++)
+        ((uint8_t *)ptr)[i] = check_byte(pos + size - 40 + i);
+    CHECK(cb_commit(&cb, 16) == CB_SUCCESS);
+    CHECK(cb_data_count(&cb) == size - 40 + 16);
+
+    /* Peek: the same two segments from the reader side */
+    n = cb_peek_contiguous(&cb, &ptr);
+    CHECK(ptr == storage + 40 && n == size - 40);
+    for (uint32_t i = 0; i < n; i++)
+        CHECK(((uint8_t *)ptr)[i] == check_byte(pos + i));
+    CHECK(cb_consume(&cb, size - 40 + 17) == CB_ERROR);
+    CHECK(cb_consume(&cb, n) == CB_SUCCESS);
+    pos += n;
+
+    n = cb_peek_contiguous(&cb, &ptr);
+    CHECK(ptr == storage && n == 16);
+    for (uint32_t i = 0; i < n; i++)
+        CHECK(((uint8_t *)ptr)[i] == check_byte(pos + i));
+    CHECK(cb_consume(&cb, 10) == CB_SUCCESS);
+    pos += 10;
+
+    /* cb_read picks up where cb_consume stopped */
+    CHECK(cb_read(&cb, io, sizeof(io)) == 6);
+    for (uint32_t i = 0; i < 6; i++)
+        CHECK(io[i] == check_byte(pos + i));
+    CHECK(cb_peek_contiguous(&cb, &ptr) == 0);
+    CHECK(cb_consume(&cb, 1) == CB_ERROR);
+
+    /* Element buffers only move whole elements */
+    CHECK(cb_init_elem(&cb, storage, 64, 4, CB_POLICY_DROP_NEW) == CB_SUCCESS);
+    CHECK(cb_write(&cb, io, 62) == 60);
+    CHECK(cb_reserve(&cb, &ptr) == 4);
+    CHECK(cb_commit(&cb, 2) == CB_ERROR);
+    CHECK(cb_peek_contiguous(&cb, &ptr) == 60);
+    CHECK(cb_consume(&cb, 6) == CB_ERROR);
+    CHECK(cb_consume(&cb, 8) == CB_SUCCESS);
+
+    printf("zero_copy size %u: done\n", size);
+}
+
+static void check_consume_overwritten(void)
+{
+    static uint8_t storage[64];
+    uint8_t io[64];
+    cbuffer_t cb;
+    cb_stats_t stats;
+    void *ptr = NULL;
+    uint32_t n = 0;
+
+    CHECK(cb_init(&cb, storage, 64, CB_POLICY_OVERWRITE) == CB_SUCCESS);
+    for (uint32_t i = 0; i < 64; i++)
+        io[i] = check_byte(i);
+    CHECK(cb_write(&cb, io, 48) == 48);
+    CHECK(cb_read(&cb, io, 40) == 40);
+
+    /* Peek the wrapped data, then let the writer lap it */
+    n = cb_peek_contiguous(&cb, &ptr);
+    CHECK(ptr == storage + 40 && n == 8);
+    for (uint32_t i = 0; i < 64; i++)
+        io[i] = check_byte(48 + i);
+    CHECK(cb_write(&cb, io, 64) == 64);
+
+    /* The peeked bytes are gone: error, and the reader moved to the oldest
+       valid byte, which is stream position 48 */
+    CHECK(cb_consume(&cb, n) == CB_ERROR);
+    CHECK(cb.writer - cb.reader == 64);
+    CHECK(cb_get_stats(&cb, &stats) == CB_SUCCESS && stats.dropped == 8);
+
+    n = cb_peek_contiguous(&cb, &ptr);
+    CHECK(ptr == storage + 48 && n == 16);
+    CHECK(n > 0 && ((uint8_t *)ptr)[0] == check_byte(48));
+    CHECK(cb_consume(&cb, n) == CB_SUCCESS);
+    n = cb_peek_contiguous(&cb, &ptr);
+    CHECK(ptr == storage && n == 48 && ((uint8_t *)ptr)[0] == check_byte(64));
+
+    printf("consume_overwritten: done\n");
+}
+
+static void check_on_watermark(void *arg)
+{
+    (*(uint32_t *)arg)++;
+}
+
+static void check_tick(cbuffer_t *cb, uint64_t *written, uint64_t *read, uint32_t *expected)
+{
+    const uint32_t size = CHECK_RECORDS * 4;
+    const uint32_t mark = CHECK_FRAME * 4;
+    uint32_t record = (uint32_t)*written;
+    uint32_t before = (uint32_t)(*written - *read);
+    uint32_t n = 0;
+    void *ptr = NULL;
+
+    /* Alternate the two write paths, both must report the crossing */
+    if ((*written / 4) & 1)
+    {
+        n = cb_write(cb, &record, 4);
+    }
+    else if (cb_reserve(cb, &ptr) >= 4)
+    {
+        memcpy(ptr, &record, 4);
+        CHECK(cb_commit(cb, 4) == CB_SUCCESS);
+        n = 4;
+    }
+
+    if (cb->policy == CB_POLICY_DROP_NEW)
+        CHECK(n == (before < size ? 4u : 0u));
+    *written += n;
+    if (*written - *read > size)
+        *read = *written - size;
+
+    uint32_t after = (uint32_t)(*written - *read);
+    if (before < mark && after >= mark)
+        (*expected)++;
+    CHECK(wm_fires == *expected);
+}
+
+static void check_watermark(cb_policy_t policy)
+{
+    static uint32_t storage[CHECK_RECORDS];
+    cbuffer_t cb;
+    cb_stats_t stats;
+    uint64_t written = 0; /* Bytes written, model */
+    uint64_t read = 0;    /* Stream position of the oldest stored byte, model */
+    uint32_t expected = 0;
+    uint32_t frames = 0;
+    uint32_t seed = 5;
+    uint32_t tick = 0;
+
+    CHECK(cb_init_elem(&cb, storage, sizeof(storage), 4, policy) == CB_SUCCESS);
+    CHECK(cb_set_watermark(&cb, CHECK_FRAME * 4, check_on_watermark, &wm_fires) == CB_SUCCESS);
+    wm_fires = 0;
+
+    while (tick < CHECK_TICKS)
+    {
+        /* Main loop sleeps for a while; one wake in 64 comes late enough
+           for the ISR to fill the buffer */
+        seed = seed * 1664525u + 1013904223u;
+        uint32_t gap = ((seed >> 26) == 0) ? 1500 : 1 + (seed >> 8) % 160;
+        for (uint32_t i = 0; i < gap; i++, tick++)
+            check_tick(&cb, &written, &read, &expected);
+
+        /* Sometimes read a few records first, so drains start off-frame */
+        uint32_t fires = wm_fires;
+        if ((seed & 7) == 0)
+        {
+            uint32_t io[8];
+            uint32_t want = 4 * (1 + (seed >> 4) % 8);
+            uint32_t got = cb_read(&cb, io, want);
+            uint32_t avail = (uint32_t)(written - read);
+            CHECK(got == (want < avail ? want : avail));
+            CHECK(got == 0 || io[0] == (uint32_t)read);
+            read += got;
+        }
+
+        /* Drain every full frame, as main.c does after the flag */
+        while (cb_data_count(&cb) >= CHECK_FRAME * 4)
+        {
+            uint32_t count = 0;
+            while (count < CHECK_FRAME)
+            {
+                void *ptr = NULL;
+                uint32_t avail = cb_peek_contiguous(&cb, &ptr) / 4;
+                if (avail == 0)
+                    break;
+                if (avail > CHECK_FRAME - count)
+                    avail = CHECK_FRAME - count;
+                CHECK(*(uint32_t *)ptr == (uint32_t)read);
+
+                /* An ISR tick between peek and consume; it may overwrite */
+                uint64_t peeked = read;
+                seed = seed * 1664525u + 1013904223u;
+                if (((seed >> 12) & 3) == 0)
+                {
+                    check_tick(&cb, &written, &read, &expected);
+                    tick++;
+                    fires = wm_fires;
+                }
+
+                /* The model moved read only if the peeked record was lost */
+                if (cb_consume(&cb, avail * 4) != CB_SUCCESS)
+                {
+                    CHECK(policy == CB_POLICY_OVERWRITE && read != peeked);
+                    break;
+                }
+                CHECK(read == peeked);
+                read += avail * 4;
+                count += avail;
+            }
+            frames++;
+        }
+
+        /* Reads, consumes and drains never fire the callback */
+        CHECK(wm_fires == fires);
+        CHECK(cb_data_count(&cb) == (uint32_t)(written - read));
+    }
+
+    CHECK(cb_get_stats(&cb, &stats) == CB_SUCCESS);
+    CHECK(expected > 1000 && (policy == CB_POLICY_DROP_NEW || stats.overflow_events > 0));
+    printf("watermark %s: %u ticks, %u frames, %u crossings, %u callbacks\n",
+           policy == CB_POLICY_DROP_NEW ? "drop_new" : "overwrite", tick, frames, expected, wm_fires);
+}
+
+/* End of file -------------------------------------------------------- */
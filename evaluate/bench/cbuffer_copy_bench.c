@@ -0,0 +1,260 @@
+/**
+ * @file       cbuffer_copy_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Two-segment memcpy cb_write/cb_read against the original
+ *             per-byte transfer loop, chunk sizes 1..4096.
+ *
+ * @note       Build and run on x86-64 Linux from the repository root:
+ *             gcc -O2 -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/cbuffer_copy_bench.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o cbuffer_copy_bench
+ *             ./cbuffer_copy_bench [--quick] > result.json
+ *             The baseline is the cb_write_byte/cb_read_byte loop the
+ *             buffer used before, kept here as bytewise_*. Both run on a
+ *             4097-byte buffer (indices wrap at size, 4096 usable) and an
+ *             8192-byte buffer (free-running indices). A randomised
+ *             write/read sequence must give the same bytes on both paths;
+ *             the exit status is 1 when it does not.
+ * @example    cbuffer_copy_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "cbuffer.h"
+#include <time.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_BYTES     (64u << 20) /*!< Bytes moved per case */
+#define BENCH_MAX_CHUNK (4096u)     /*!< Largest chunk */
+#define BENCH_MOD_SIZE  (4097u)     /*!< Non power of two: 4096 usable bytes */
+#define BENCH_POW2_SIZE (8192u)     /*!< Power of two: free-running indices */
+#define BENCH_CHECK_OPS (200000)    /*!< Operations in the equivalence check */
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief Original byte-at-a-time buffer: indices wrap at size.
+ */
+typedef struct
+{
+    uint8_t *data;            /**< Pointer to buffer */
+    uint32_t size;            /**< Size of buffer */
+    volatile uint32_t writer; /**< Index to write */
+    volatile uint32_t reader; /**< Index to read */
+} bytewise_t;
+
+/* Private variables -------------------------------------------------- */
+static uint8_t src_block[BENCH_MAX_CHUNK];
+static uint8_t dst_block[BENCH_MAX_CHUNK];
+static volatile uint32_t sink;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/**
+ * @brief  Per-byte write, as the original cb_write.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of bytes written
+ */
+static uint32_t bytewise_write(bytewise_t *cb, const uint8_t *buf, uint32_t nbytes);
+
+/**
+ * @brief  Per-byte read, as the original cb_read.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of bytes read
+ */
+static uint32_t bytewise_read(bytewise_t *cb, uint8_t *buf, uint32_t nbytes);
+
+/**
+ * @brief  Time write-then-read rounds of one chunk size on both paths.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_case(uint32_t size, uint32_t chunk, uint64_t total, int last);
+
+/**
+ * @brief  Run the same random operations on both paths and compare bytes.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of mismatched operations
+ */
+static uint32_t bench_check(uint32_t size);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    uint64_t total = BENCH_BYTES;
+    if (argc > 1 && strcmp(argv[1], "--quick") == 0)
+        total /= 16;
+
+    for (uint32_t i = 0; i < sizeof(src_block); i++)
+        src_block[i] = (uint8_t)(i * 7 + 3);
+
+    uint32_t mismatches = bench_check(BENCH_MOD_SIZE) + bench_check(BENCH_POW2_SIZE);
+
+    printf("{\n  \"benchmark\": \"cbuffer_copy\",\n  \"mismatches\": %u,\n  \"results\": [\n", mismatches);
+    for (uint32_t chunk = 1; chunk <= BENCH_MAX_CHUNK; chunk <<= 1)
+        bench_case(BENCH_MOD_SIZE, chunk, total, 0);
+    for (uint32_t chunk = 1; chunk <= BENCH_MAX_CHUNK; chunk <<= 1)
+        bench_case(BENCH_POW2_SIZE, chunk, total, chunk == BENCH_MAX_CHUNK);
+    printf("  ]\n}\n");
+
+    return mismatches ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint32_t bytewise_write(bytewise_t *cb, const uint8_t *buf, uint32_t nbytes)
+{
+    uint32_t i = 0;
+    for (; i < nbytes; i++)
+    {
+        uint32_t next = cb->writer + 1;
+        if (next == cb->size)
+            next = 0;
+        if (next == cb->reader)
+            break;
+
+        cb->data[cb->writer] = buf[i];
+        cb->writer = next;
+    }
+
+    return i;
+}
+
+static uint32_t bytewise_read(bytewise_t *cb, uint8_t *buf, uint32_t nbytes)
+{
+    uint32_t i = 0;
+    for (; i < nbytes && cb->reader != cb->writer; i++)
+    {
+        uint32_t next = cb->reader + 1;
+        if (next == cb->size)
+            next = 0;
+
+        buf[i] = cb->data[cb->reader];
+        cb->reader = next;
+    }
+
+    return i;
+}
+
+static void bench_case(uint32_t size, uint32_t chunk, uint64_t total, int last)
+{
+    cbuffer_t cb;
+    bytewise_t bw;
+    uint8_t *storage = malloc(size);
+    uint64_t t0 = 0;
+    uint64_t memcpy_ns = 0;
+    uint64_t bytewise_ns = 0;
+
+    /* Keep 1-byte chunks affordable, they are dominated by call cost */
+    total = total * chunk / (chunk + 64);
+    if (total < chunk)
+        total = chunk;
+
+    cb_init(&cb, storage, size, CB_POLICY_DROP_NEW);
+    bw.data = storage;
+    bw.size = size;
+    bw.writer = 0;
+    bw.reader = 0;
+
+    /* One chunk in, one chunk out: the fill level stays at one chunk and
+       the indices sweep the whole array, so every wrap position occurs */
+    t0 = bench_now();
+    for (uint64_t moved = 0; moved < total; moved += chunk)
+    {
+        sink += cb_write(&cb, src_block, chunk);
+        sink += cb_read(&cb, dst_block, chunk);
+    }
+    memcpy_ns = bench_now() - t0;
+
+    t0 = bench_now();
+    for (uint64_t moved = 0; moved < total; moved += chunk)
+    {
+        sink += bytewise_write(&bw, src_block, chunk);
+        sink += bytewise_read(&bw, dst_block, chunk);
+    }
+    bytewise_ns = bench_now() - t0;
+
+    printf("    {\"buffer_bytes\": %u, \"free_running\": %s, \"chunk_bytes\": %u, \"bytes\": %llu, "
+           "\"memcpy_bytes_per_s\": %.0f, \"bytewise_bytes_per_s\": %.0f, \"speedup\": %.2f}%s\n",
+           size, cb.mask ? "true" : "false", chunk, (unsigned long long)total, (double)total * 1e9 / memcpy_ns,
+           (double)total * 1e9 / bytewise_ns, (double)bytewise_ns / memcpy_ns, last ? "" : ",");
+    free(storage);
+}
+
+static uint32_t bench_check(uint32_t size)
+{
+    cbuffer_t cb;
+    bytewise_t bw;
+    uint8_t *a = malloc(size);
+    uint8_t *b = malloc(size);
+    static uint8_t out_a[BENCH_MAX_CHUNK];
+    static uint8_t out_b[BENCH_MAX_CHUNK];
+    uint32_t seed = 2025;
+    uint32_t mismatches = 0;
+
+    cb_init(&cb, a, size, CB_POLICY_DROP_NEW);
+    bw.data = b;
+    bw.size = size;
+    bw.writer = 0;
+    bw.reader = 0;
+
+    for (int op = 0; op < BENCH_CHECK_OPS; op++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        uint32_t n = (seed >> 8) % (BENCH_MAX_CHUNK + 1);
+        uint32_t offset = (seed >> 20) % 64;
+        if (n + offset > BENCH_MAX_CHUNK)
+            n = BENCH_MAX_CHUNK - offset;
+
+        /* Free-running buffers hold one byte more than the wrap-at-size
+           baseline, so only the amounts the baseline accepts are compared */
+        if (seed & 1)
+        {
+            uint32_t written = bytewise_write(&bw, src_block + offset, n);
+            if (cb_write(&cb, src_block + offset, written) != written)
+                mismatches++;
+        }
+        else
+        {
+            uint32_t got = bytewise_read(&bw, out_b, n);
+            if (cb_read(&cb, out_a, got) != got || memcmp(out_a, out_b, got) != 0)
+                mismatches++;
+        }
+    }
+
+    free(a);
+    free(b);
+    return mismatches;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,173 @@
+/**
+ * @file       filter_bank_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Bit-exact check and benchmark of the multi-lead Bandpass
+ *             Filter bank against one BandpassFilter per lead.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O3 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/filter_bank_bench.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o filter_bank_bench
+ *             ./filter_bank_bench [evaluate/data/100.dat]
+ *             Add -DFILTER_BANK_PAIRED to run the Cortex-M4 halfword-pair
+ *             path with the portable operations. Leads are MLII and V5 of
+ *             record 100, repeated with a time shift for more than two.
+ *             Costs are per lead-sample, TSC cycles on x86, ns elsewhere.
+ * @example    filter_bank_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_REPEAT (5)    /*!< Passes over the record per case */
+#define BENCH_SHIFT  (1031) /*!< Time shift between repeated leads */
+
+/* Private variables -------------------------------------------------- */
+static const uint8_t lead_counts[] = {2, 3, 8, 12};
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Cycle counter, or ns where no cycle counter is available.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current count
+ */
+static uint64_t bench_cycles(void);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    size_t n_v5 = 0;
+    size_t mismatches = 0;
+    int32_t *mlii = mitbih_load(path, 2, 0, &n);
+    int32_t *v5 = mitbih_load(path, 2, 1, &n_v5);
+    if (mlii == NULL || v5 == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    int16_t *in = malloc(n * BANDPASS_BANK_MAX_LEADS * sizeof(int16_t));
+    int16_t *out = malloc(n * BANDPASS_BANK_MAX_LEADS * sizeof(int16_t));
+    int32_t *lead_in = malloc(n * sizeof(int32_t));
+    int32_t *lead_out = malloc(n * sizeof(int32_t));
+
+    printf("{\n  \"benchmark\": \"bandpass_bank\",\n  \"samples\": %zu,\n", n);
+#if defined(__x86_64__) || defined(__i386__)
+    printf("  \"unit\": \"tsc_cycles_per_lead_sample\",\n");
+#else
+    printf("  \"unit\": \"ns_per_lead_sample\",\n");
+#endif
+#if defined(__ARM_FEATURE_DSP) || defined(FILTER_BANK_PAIRED)
+    printf("  \"bank_path\": \"pairs\",\n  \"results\": [\n");
+#else
+    printf("  \"bank_path\": \"per_lead\",\n  \"results\": [\n");
+#endif
+
+    for (size_t c = 0; c < sizeof(lead_counts); c++)
+    {
+        uint8_t leads = lead_counts[c];
+        BandpassFilterBank bank;
+        BandpassFilter scalar[BANDPASS_BANK_MAX_LEADS];
+        uint64_t t0 = 0;
+        double bank_cost = 0;
+        double scalar_cost = 0;
+
+        /* Interleave: even leads from MLII, odd from V5, shifted per pair */
+        for (size_t t = 0; t < n; t++)
+        {
+            for (uint8_t l = 0; l < leads; l++)
+            {
+                size_t k = (t + (size_t)(l / 2) * BENCH_SHIFT) % n;
+                in[t * leads + l] = (int16_t)(((l & 1) && k < n_v5) ? v5[k] : mlii[k]) * 2;
+            }
+        }
+
+        BandpassFilterBank_Init(&bank, leads);
+        BandpassFilterBank_ApplyBlock(&bank, in, out, n);
+        for (uint8_t l = 0; l < leads; l++)
+        {
+            for (size_t t = 0; t < n; t++)
+                lead_in[t] = in[t * leads + l];
+            BandpassFilter_Init(&scalar[l]);
+            BandpassFilter_ApplyBlock(&scalar[l], lead_in, lead_out, n);
+            for (size_t t = 0; t < n; t++)
+                mismatches += (lead_out[t] != out[t * leads + l]);
+        }
+
+        t0 = bench_cycles();
+        for (int r = 0; r < BENCH_REPEAT; r++)
+        {
+            BandpassFilterBank_Init(&bank, leads);
+            BandpassFilterBank_ApplyBlock(&bank, in, out, n);
+        }
+        bank_cost = (double)(bench_cycles() - t0) / ((double)n * leads * BENCH_REPEAT);
+
+        /* Baseline: one filter per lead, each stepping through the interleaved data */
+        t0 = bench_cycles();
+        for (int r = 0; r < BENCH_REPEAT; r++)
+        {
+            for (uint8_t l = 0; l < leads; l++)
+                BandpassFilter_Init(&scalar[l]);
+            for (size_t t = 0; t < n; t++)
+            {
+                for (uint8_t l = 0; l < leads; l++)
+                {
+                    int32_t x = in[t * leads + l];
+                    BandpassFilter_ApplyBlock(&scalar[l], &x, &x, 1);
+                    out[t * leads + l] = (int16_t)x;
+                }
+            }
+        }
+        scalar_cost = (double)(bench_cycles() - t0) / ((double)n * leads * BENCH_REPEAT);
+
+        printf("    {\"leads\": %u, \"bank\": %.3f, \"per_lead_filters\": %.3f, \"speedup\": %.2f}%s\n",
+               leads, bank_cost, scalar_cost, scalar_cost / bank_cost,
+               (c + 1 < sizeof(lead_counts)) ? "," : "");
+    }
+
+    printf("  ],\n  \"mismatches\": %zu\n}\n", mismatches);
+
+    free(mlii);
+    free(v5);
+    free(in);
+    free(out);
+    free(lead_in);
+    free(lead_out);
+    return mismatches ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,132 @@
+/**
+ * @file       filter_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host benchmark for the firmware Bandpass Filter APIs.
+ *             Filters MIT-BIH record 100 sample by sample and in blocks,
+ *             checks both give the same output and prints samples/s as JSON.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/filter_bench.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o filter_bench
+ *             ./filter_bench [evaluate/data/100.dat] [--label NAME]
+ *             The single-sample API includes its trace record, which is
+ *             dropped because the bench never initializes trace_irq.
+ * @example    filter_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_REPEAT (20) /*!< Passes over the record per case */
+
+/* Private variables -------------------------------------------------- */
+static const size_t block_sizes[] = {1, 16, 32, 64, 256, 4096, 0}; /* 0: whole record */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = "evaluate/data/100.dat";
+    const char *label = "";
+    BandpassFilter filter;
+    size_t n = 0;
+    int32_t *signal = NULL;
+    int32_t *expected = NULL;
+    int32_t *actual = NULL;
+    uint64_t t0 = 0;
+    uint64_t elapsed = 0;
+    int status = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--label") == 0 && i + 1 < argc)
+            label = argv[++i];
+        else
+            path = argv[i];
+    }
+
+    signal = mitbih_load(path, 2, 0, &n);
+    if (signal == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+    expected = malloc(n * sizeof(int32_t));
+    actual = malloc(n * sizeof(int32_t));
+
+    printf("{\n  \"benchmark\": \"bandpass_filter\",\n  \"label\": \"%s\",\n  \"samples\": %zu,\n", label, n);
+    printf("  \"results\": [\n");
+
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilter_Init(&filter);
+        for (size_t i = 0; i < n; i++)
+            expected[i] = BandpassFilter_Apply(&filter, signal[i]);
+    }
+    elapsed = bench_now() - t0;
+    printf("    {\"api\": \"BandpassFilter_Apply\", \"block\": 1, \"samples_per_s\": %.0f, \"ns_per_sample\": %.3f}",
+           (double)n * BENCH_REPEAT * 1e9 / elapsed, (double)elapsed / ((double)n * BENCH_REPEAT));
+
+    for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]); b++)
+    {
+        size_t block = block_sizes[b] ? block_sizes[b] : n;
+        t0 = bench_now();
+        for (int r = 0; r < BENCH_REPEAT; r++)
+        {
+            BandpassFilter_Init(&filter);
+            for (size_t i = 0; i < n; i += block)
+                BandpassFilter_ApplyBlock(&filter, &signal[i], &actual[i], (n - i < block) ? n - i : block);
+        }
+        elapsed = bench_now() - t0;
+
+        int same = memcmp(expected, actual, n * sizeof(int32_t)) == 0;
+        if (!same)
+            status = 1;
+        printf(",\n    {\"api\": \"BandpassFilter_ApplyBlock\", \"block\": %zu, \"samples_per_s\": %.0f, "
+               "\"ns_per_sample\": %.3f, \"matches_apply\": %s}",
+               block, (double)n * BENCH_REPEAT * 1e9 / elapsed, (double)elapsed / ((double)n * BENCH_REPEAT),
+               same ? "true" : "false");
+    }
+
+    printf("\n  ]\n}\n");
+    free(signal);
+    free(expected);
+    free(actual);
+    return status;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* End of file -------------------------------------------------------- */
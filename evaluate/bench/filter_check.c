@@ -0,0 +1,141 @@
+/**
+ * @file       filter_check.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host check that BandpassFilter_Apply is bit-exact against the
+ *             original shift-register implementation on MIT-BIH record 100.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/filter_check.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o filter_check
+ *             ./filter_check [evaluate/data/100.dat]
+ *             Exit status is 0 when every output sample matches.
+ * @example    filter_check.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief Original filter state, shift registers only.
+ */
+typedef struct
+{
+    int32_t lowpass_buffer[BANDPASS_LOWPASS_WINDOW_SIZE];   /**< Newest sample first */
+    int32_t highpass_buffer[BANDPASS_HIGHPASS_WINDOW_SIZE]; /**< Newest lowpass output first */
+} ReferenceFilter;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Original BandpassFilter_Apply: shift both windows and re-sum them.
+ *
+ * @param[inout]  filter      Pointer to the ReferenceFilter structure.
+ * @param[in]     new_sample  New ADC sample to be filtered.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Filtered value (int32_t)
+ */
+static int32_t reference_apply(ReferenceFilter *filter, int32_t new_sample);
+
+/**
+ * @brief  Run both filters over a signal and count mismatches.
+ *
+ * @param[in]  signal  Input samples.
+ * @param[in]  n       Number of samples.
+ * @param[in]  scale   Multiplier applied to every sample.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of mismatching samples
+ */
+static size_t check_signal(const int32_t *signal, size_t n, int32_t scale);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    size_t mismatches = 0;
+    int32_t *signal = mitbih_load(path, 2, 0, &n);
+    if (signal == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    /* Record values (11-bit) and the 12-bit range the STM32 ADC produces */
+    mismatches += check_signal(signal, n, 1);
+    mismatches += check_signal(signal, n, 2);
+
+    printf("%zu samples x 2 scales, %zu mismatches\n", n, mismatches);
+    free(signal);
+    return mismatches ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static int32_t reference_apply(ReferenceFilter *filter, int32_t new_sample)
+{
+    for (uint8_t i = BANDPASS_LOWPASS_WINDOW_SIZE - 1; i > 0; i--)
+        filter->lowpass_buffer[i] = filter->lowpass_buffer[i - 1];
+    filter->lowpass_buffer[0] = new_sample;
+
+    int32_t lowpass = 0;
+    for (uint8_t i = 0; i < BANDPASS_LOWPASS_WINDOW_SIZE; i++)
+        lowpass += filter->lowpass_buffer[i];
+    lowpass = (lowpass * 384) >> 10;
+
+    for (uint16_t i = BANDPASS_HIGHPASS_WINDOW_SIZE - 1; i > 0; i--)
+        filter->highpass_buffer[i] = filter->highpass_buffer[i - 1];
+    filter->highpass_buffer[0] = lowpass;
+
+    int32_t lowpass_average = 0;
+    for (uint16_t i = 0; i < BANDPASS_HIGHPASS_WINDOW_SIZE; i++)
+        lowpass_average += filter->highpass_buffer[i];
+    lowpass_average >>= 7;
+
+    int32_t highpass = lowpass - lowpass_average;
+    if (highpass > 32767) highpass = 32767;
+    if (highpass < -32768) highpass = -32768;
+
+    return highpass;
+}
+
+static size_t check_signal(const int32_t *signal, size_t n, int32_t scale)
+{
+    ReferenceFilter reference = {0};
+    BandpassFilter filter;
+    size_t mismatches = 0;
+
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t x = signal[i] * scale;
+        int32_t expected = reference_apply(&reference, x);
+        int32_t actual = BandpassFilter_Apply(&filter, x);
+        if (expected != actual)
+        {
+            if (mismatches < 10)
+                fprintf(stderr, "scale %d sample %zu: expected %d got %d\n", scale, i, expected, actual);
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/* End of file -------------------------------------------------------- */
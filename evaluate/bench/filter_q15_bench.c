@@ -0,0 +1,211 @@
+/**
+ * @file       filter_q15_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Bit-exact check and cycle count of the packed-halfword (Q15)
+ *             Bandpass Filter against the scalar version.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/filter_q15_bench.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o filter_q15_bench
+ *             ./filter_q15_bench [evaluate/data/100.dat]
+ *             On x86 cycles come from the TSC. Any other host reports
+ *             nanoseconds instead; the JSON "unit" field says which.
+ *             The host build always runs the portable C path, the intrinsic
+ *             path is only compiled for cores with __ARM_FEATURE_DSP.
+ * @example    filter_q15_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_REPEAT (20) /*!< Passes over the record per case */
+#define BENCH_BLOCK  (32) /*!< Block size, one DMA half-buffer */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Cycle counter, or ns where no cycle counter is available.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current count
+ */
+static uint64_t bench_cycles(void);
+
+/**
+ * @brief  Compare the Q15 kernel with BandpassFilter_Apply on one signal,
+ *         using an irregular block split that includes odd lengths.
+ *
+ * @param[in]  signal  Input samples, -8738..8737.
+ * @param[in]  n       Number of samples.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of mismatching samples
+ */
+static size_t check_signal(const int16_t *signal, size_t n);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    BandpassFilter scalar;
+    BandpassFilterQ15 packed;
+    size_t n = 0;
+    size_t mismatches = 0;
+    uint64_t t0 = 0;
+    double scalar_cost = 0;
+    double block_cost = 0;
+    double q15_cost = 0;
+    int32_t *record = mitbih_load(path, 2, 0, &n);
+    if (record == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    int16_t *signal = malloc(n * sizeof(int16_t));
+    int16_t *out16 = malloc(n * sizeof(int16_t));
+    int32_t *in32 = malloc(n * sizeof(int32_t));
+    int32_t *out32 = malloc(n * sizeof(int32_t));
+
+    /* 11-bit record scaled to the 12-bit ADC range, and the raw record */
+    for (size_t i = 0; i < n; i++)
+        signal[i] = (int16_t)(record[i] * 2);
+    mismatches += check_signal(signal, n);
+    for (size_t i = 0; i < n; i++)
+        signal[i] = (int16_t)record[i];
+    mismatches += check_signal(signal, n);
+    /* Full-scale square wave, the worst case for the halfword differences */
+    for (size_t i = 0; i < n; i++)
+        signal[i] = ((i / 3) & 1) ? 4095 : -4096;
+    mismatches += check_signal(signal, n);
+    /* Square wave at the documented input limit, slow enough for the
+       low-pass output to swing fully inside one high-pass window */
+    for (size_t i = 0; i < n; i++)
+        signal[i] = ((i / 40) & 1) ? 8737 : -8738;
+    mismatches += check_signal(signal, n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        signal[i] = (int16_t)(record[i] * 2);
+        in32[i] = signal[i];
+    }
+
+    t0 = bench_cycles();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilter_Init(&scalar);
+        for (size_t i = 0; i < n; i++)
+            out32[i] = BandpassFilter_Apply(&scalar, in32[i]);
+    }
+    scalar_cost = (double)(bench_cycles() - t0) / ((double)n * BENCH_REPEAT);
+
+    t0 = bench_cycles();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilter_Init(&scalar);
+        for (size_t i = 0; i < n; i += BENCH_BLOCK)
+            BandpassFilter_ApplyBlock(&scalar, &in32[i], &out32[i], (n - i < BENCH_BLOCK) ? n - i : BENCH_BLOCK);
+    }
+    block_cost = (double)(bench_cycles() - t0) / ((double)n * BENCH_REPEAT);
+
+    t0 = bench_cycles();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilterQ15_Init(&packed);
+        for (size_t i = 0; i < n; i += BENCH_BLOCK)
+            BandpassFilterQ15_ApplyBlock(&packed, &signal[i], &out16[i], (n - i < BENCH_BLOCK) ? n - i : BENCH_BLOCK);
+    }
+    q15_cost = (double)(bench_cycles() - t0) / ((double)n * BENCH_REPEAT);
+
+    printf("{\n  \"benchmark\": \"bandpass_q15\",\n  \"samples\": %zu,\n", n);
+#if defined(__x86_64__) || defined(__i386__)
+    printf("  \"unit\": \"tsc_cycles_per_sample\",\n");
+#else
+    printf("  \"unit\": \"ns_per_sample\",\n");
+#endif
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    printf("  \"q15_path\": \"intrinsics\",\n");
+#else
+    printf("  \"q15_path\": \"portable\",\n");
+#endif
+    printf("  \"mismatches\": %zu,\n", mismatches);
+    printf("  \"scalar_apply\": %.3f,\n  \"scalar_block\": %.3f,\n  \"q15_block\": %.3f\n}\n",
+           scalar_cost, block_cost, q15_cost);
+
+    free(record);
+    free(signal);
+    free(out16);
+    free(in32);
+    free(out32);
+    return mismatches ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static size_t check_signal(const int16_t *signal, size_t n)
+{
+    static const size_t splits[] = {1, 7, 32, 2, 33, 64, 5};
+    BandpassFilter scalar;
+    BandpassFilterQ15 packed;
+    int16_t out[64];
+    size_t mismatches = 0;
+    size_t i = 0;
+    size_t k = 0;
+
+    BandpassFilter_Init(&scalar);
+    BandpassFilterQ15_Init(&packed);
+    while (i < n)
+    {
+        size_t len = splits[k++ % (sizeof(splits) / sizeof(splits[0]))];
+        if (len > n - i)
+            len = n - i;
+
+        BandpassFilterQ15_ApplyBlock(&packed, &signal[i], out, len);
+        for (size_t j = 0; j < len; j++)
+        {
+            int32_t expected = BandpassFilter_Apply(&scalar, signal[i + j]);
+            if (expected != out[j])
+            {
+                if (mismatches < 10)
+                    fprintf(stderr, "sample %zu: expected %d got %d\n", i + j, expected, out[j]);
+                mismatches++;
+            }
+        }
+        i += len;
+    }
+
+    return mismatches;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,34 @@
+/**
+ * @file       hal_stub.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host definitions of the HAL symbols the pipeline references.
+ *
+ * @note       Output that the firmware would send over UART is counted in
+ *             huart2.tx_bytes and dropped, or also written to
+ *             huart2.capture when a bench sets it.
+ * @example    stm32f4xx_hal.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "mylib.h"
+
+/* Public variables --------------------------------------------------- */
+UART_HandleTypeDef huart2;
+ADC_HandleTypeDef hadc1;
+
+/* Function definitions ----------------------------------------------- */
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)timeout;
+    huart->tx_bytes += size;
+    if (huart->capture != NULL)
+        fwrite(data, 1, size, huart->capture);
+    return HAL_OK;
+}
+
+/* End of file -------------------------------------------------------- */
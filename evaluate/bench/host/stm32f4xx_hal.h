@@ -0,0 +1,61 @@
+/**
+ * @file       stm32f4xx_hal.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Minimal HAL stand-in so firmware sources build on the host.
+ *
+ * @note       Only what Core/Src pipeline files use is declared here. Put
+ *             this directory ahead of the firmware include path.
+ * @example    hal_stub.c
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef HOST_STM32F4XX_HAL_H_
+#define HOST_STM32F4XX_HAL_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief HAL status codes.
+ */
+typedef enum
+{
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+/**
+ * @brief Opaque peripheral handles.
+ */
+typedef struct
+{
+    uint32_t tx_bytes; /**< Bytes passed to HAL_UART_Transmit */
+    FILE *capture;     /**< When set, transmitted bytes are also written here */
+} UART_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t unused; /**< Not used on the host */
+} ADC_HandleTypeDef;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Count the bytes instead of sending them.
+ *
+ * @return
+ *  - HAL_OK
+ */
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, const uint8_t *data, uint16_t size, uint32_t timeout);
+
+#endif /* HOST_STM32F4XX_HAL_H_ */
+/* End of file -------------------------------------------------------- */
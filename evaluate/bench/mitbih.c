@@ -0,0 +1,246 @@
+/**
+ * @file       mitbih.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Reader for MIT-BIH records in WFDB format 212.
+ *
+ * @note       Format 212 packs two 12-bit samples in three bytes. The .atr
+ *             file is a stream of 16-bit little-endian words, 6-bit code and
+ *             10-bit time increment, with SKIP/AUX escapes.
+ * @example    mitbih.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "mitbih.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Private defines ---------------------------------------------------- */
+#define MITBIH_ANN_SKIP (59) /*!< Next 4 bytes are a long time increment */
+#define MITBIH_ANN_NUM  (60) /*!< Annotation num field, no data */
+#define MITBIH_ANN_SUB  (61) /*!< Annotation subtype field, no data */
+#define MITBIH_ANN_CHN  (62) /*!< Annotation channel field, no data */
+#define MITBIH_ANN_AUX  (63) /*!< Auxiliary string follows */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Read a whole file into memory.
+ *
+ * @param[in]   path  Path to the file.
+ * @param[out]  size  Number of bytes read.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Pointer to contents: Success
+ *  - NULL: Error
+ */
+static uint8_t *mitbih_read_file(const char *path, size_t *size);
+
+/**
+ * @brief  Whether an annotation code marks a beat.
+ *
+ * @param[in]  code  Annotation code.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - 1: Beat
+ *  - 0: Other annotation
+ */
+static int mitbih_is_beat(uint32_t code);
+
+/* Function definitions ----------------------------------------------- */
+int32_t *mitbih_load(const char *path, int nsig, int channel, size_t *nsamples)
+{
+    size_t size = 0;
+    size_t count = 0;
+    size_t total = 0;
+    int32_t *out = NULL;
+    uint8_t *raw = NULL;
+    if (path == NULL || nsamples == NULL || nsig < 1 || channel < 0 || channel >= nsig)
+        return NULL;
+
+    raw = mitbih_read_file(path, &size);
+    if (raw == NULL)
+        return NULL;
+
+    /* Every 3 bytes hold 2 samples, interleaved across signals */
+    total = (size / 3) * 2;
+    out = malloc((total / nsig + 1) * sizeof(int32_t));
+    if (out == NULL)
+    {
+        free(raw);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < total; i++)
+    {
+        const uint8_t *p = raw + (i / 2) * 3;
+        int32_t value = (i & 1) ? (p[2] | ((p[1] & 0xF0) << 4)) : (p[0] | ((p[1] & 0x0F) << 8));
+        if (value & 0x800)
+            value -= 0x1000;
+        if ((int)(i % nsig) == channel)
+            out[count++] = value;
+    }
+
+    free(raw);
+    *nsamples = count;
+    return out;
+}
+
+uint32_t *mitbih_load_beats(const char *path, size_t *nbeats)
+{
+    size_t size = 0;
+    size_t count = 0;
+    size_t pos = 0;
+    uint32_t time = 0;
+    uint32_t *out = NULL;
+    uint8_t *raw = NULL;
+    if (path == NULL || nbeats == NULL)
+        return NULL;
+
+    raw = mitbih_read_file(path, &size);
+    if (raw == NULL)
+        return NULL;
+
+    /* At most one annotation per word */
+    out = malloc((size / 2 + 1) * sizeof(uint32_t));
+    if (out == NULL)
+    {
+        free(raw);
+        return NULL;
+    }
+
+    while (pos + 1 < size)
+    {
+        uint32_t word = raw[pos] | (raw[pos + 1] << 8);
+        uint32_t code = word >> 10;
+        uint32_t value = word & 0x3FF;
+        pos += 2;
+
+        if (word == 0)
+            break;
+
+        if (code == MITBIH_ANN_SKIP)
+        {
+            /* PDP-11 long: high word first */
+            if (pos + 3 >= size)
+                break;
+            time += ((uint32_t)(raw[pos] | (raw[pos + 1] << 8)) << 16) | (raw[pos + 2] | (raw[pos + 3] << 8));
+            pos += 4;
+        }
+        else if (code == MITBIH_ANN_AUX)
+        {
+            pos += (value + 1) & ~1u;
+        }
+        else if (code == MITBIH_ANN_NUM || code == MITBIH_ANN_SUB || code == MITBIH_ANN_CHN)
+        {
+            /* Field updates for the previous annotation, nothing to keep */
+        }
+        else
+        {
+            time += value;
+            if (mitbih_is_beat(code))
+                out[count++] = time;
+        }
+    }
+
+    free(raw);
+    *nbeats = count;
+    return out;
+}
+
+void mitbih_to_adc(int32_t *x, size_t n)
+{
+    int32_t lo = INT32_MAX;
+    int32_t hi = INT32_MIN;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (x[i] < lo)
+            lo = x[i];
+        if (x[i] > hi)
+            hi = x[i];
+    }
+    if (hi == lo)
+        return;
+
+    for (size_t i = 0; i < n; i++)
+        x[i] = (int32_t)(((int64_t)(x[i] - lo) * 4095 + (hi - lo) / 2) / (hi - lo));
+}
+
+mitbih_score_t mitbih_score(const uint32_t *detected, size_t ndetected, const uint32_t *beats, size_t nbeats,
+                            uint32_t tolerance)
+{
+    mitbih_score_t score = {0};
+    size_t d = 0;
+
+    for (size_t b = 0; b < nbeats; b++)
+    {
+        /* Detections too early for this beat can match nothing later */
+        while (d < ndetected && detected[d] + tolerance < beats[b])
+        {
+            score.fp++;
+            d++;
+        }
+        if (d < ndetected && detected[d] <= beats[b] + tolerance)
+        {
+            /* Leave the detection to the next beat if it is nearer there */
+            if (b + 1 < nbeats && detected[d] > beats[b] && beats[b + 1] - detected[d] < detected[d] - beats[b] &&
+                beats[b + 1] <= detected[d] + tolerance)
+            {
+                score.fn++;
+                continue;
+            }
+            score.tp++;
+            d++;
+        }
+        else
+        {
+            score.fn++;
+        }
+    }
+    score.fp += ndetected - d;
+    score.se = (score.tp + score.fn) ? (double)score.tp / (double)(score.tp + score.fn) : 0.0;
+    score.ppv = (score.tp + score.fp) ? (double)score.tp / (double)(score.tp + score.fp) : 0.0;
+    return score;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint8_t *mitbih_read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *buf = NULL;
+    long len = 0;
+    if (f == NULL)
+        return NULL;
+
+    if (fseek(f, 0, SEEK_END) == 0)
+        len = ftell(f);
+    rewind(f);
+
+    if (len > 0)
+        buf = malloc((size_t)len);
+    if (buf != NULL && fread(buf, 1, (size_t)len, f) != (size_t)len)
+    {
+        free(buf);
+        buf = NULL;
+    }
+
+    fclose(f);
+    *size = (size_t)len;
+    return buf;
+}
+
+static int mitbih_is_beat(uint32_t code)
+{
+    /* NORMAL..PACE, UNKNOWN, AESC, SVESC, PFUS */
+    return (code >= 1 && code <= 13) || code == 34 || code == 35 || code == 38;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,108 @@
+/**
+ * @file       mitbih.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Reader for MIT-BIH records in WFDB format 212.
+ *
+ * @note       Host benchmarks and checks use it to feed evaluate/data/100
+ *             through firmware code without Python or wfdb.
+ * @example    filter_check.c
+ *             size_t n;
+ *             int32_t *mlii = mitbih_load("evaluate/data/100.dat", 2, 0, &n);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef MITBIH_H_
+#define MITBIH_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define MITBIH_FS (360) /*!< Sampling rate of the MIT-BIH database */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Beat-by-beat comparison against the annotations.
+ */
+typedef struct
+{
+    size_t tp; /*!< Detections matched to a beat */
+    size_t fp; /*!< Detections with no beat in tolerance */
+    size_t fn; /*!< Beats with no detection in tolerance */
+    double se; /*!< Sensitivity, tp / (tp + fn) */
+    double ppv; /*!< Positive predictivity, tp / (tp + fp) */
+} mitbih_score_t;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Load one channel of a format 212 signal file.
+ *
+ * @param[in]   path      Path to the .dat file.
+ * @param[in]   nsig      Number of interleaved signals in the file.
+ * @param[in]   channel   Channel to return, 0-based.
+ * @param[out]  nsamples  Number of samples returned.
+ *
+ * @attention  Values are the stored ADC codes, sign-extended from 12 bits
+ *             (record 100: 11-bit, zero at 1024). Caller frees the result.
+ *
+ * @return
+ *  - Pointer to samples: Success
+ *  - NULL: Error
+ */
+int32_t *mitbih_load(const char *path, int nsig, int channel, size_t *nsamples);
+
+/**
+ * @brief  Load the sample indices of beat annotations from a .atr file.
+ *
+ * @param[in]   path    Path to the .atr file.
+ * @param[out]  nbeats  Number of beat annotations returned.
+ *
+ * @attention  Only beat labels are kept (N, L, R, a, V, F, J, A, S, E, j,
+ *             /, Q, e, n, f). Caller frees the result.
+ *
+ * @return
+ *  - Pointer to sample indices: Success
+ *  - NULL: Error
+ */
+uint32_t *mitbih_load_beats(const char *path, size_t *nbeats);
+
+/**
+ * @brief  Stretch samples to the 0..4095 ADC range, in place.
+ *
+ * @param[inout]  x  Samples.
+ * @param[in]     n  Number of samples.
+ *
+ * @attention  Min-max over the whole array, as normalize_signal in
+ *             evaluate/src/evaluate_filter.py.
+ *
+ * @return
+ *  - None
+ */
+void mitbih_to_adc(int32_t *x, size_t n);
+
+/**
+ * @brief  Match detections to beats one-to-one and score them.
+ *
+ * @param[in]  detected   Detected sample indices, ascending.
+ * @param[in]  ndetected  Number of detections.
+ * @param[in]  beats      Annotated sample indices, ascending, same rate.
+ * @param[in]  nbeats     Number of beats.
+ * @param[in]  tolerance  Largest |detection - beat| that counts, in samples.
+ *
+ * @attention  Each beat takes at most one detection, the nearest one
+ *             still free. evaluate_filter.py uses 10 samples at 200 Hz.
+ *
+ * @return
+ *  - Counts, Se and PPV
+ */
+mitbih_score_t mitbih_score(const uint32_t *detected, size_t ndetected, const uint32_t *beats, size_t nbeats,
+                            uint32_t tolerance);
+
+#endif /* MITBIH_H_ */
+/* End of file -------------------------------------------------------- */
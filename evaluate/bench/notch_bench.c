@@ -0,0 +1,227 @@
+/**
+ * @file       notch_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Mains attenuation and cost of the notch chained after the
+ *             Bandpass Filter, on record 100 with synthetic mains added.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/notch_bench.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/notch.c
+ *                 Embedded/QRS_ECG/Core/Src/biquad.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -lm -o notch_bench
+ *             ./notch_bench [evaluate/data/100.dat]
+ *             The record is fed as the firmware's 200 Hz stream, like the
+ *             other filter benches. Mains residual is the output difference
+ *             between the corrupted and the clean record, after 2 s of
+ *             settling; ecg_change is the notch's effect on the clean
+ *             record. Detector peaks are summed over 10 s windows. Cost
+ *             is x86 TSC cycles per sample of the ISR chain.
+ * @example    notch_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "notch.h"
+#include "qrs_detector.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_FS        (200.0) /*!< Firmware sample rate */
+#define BENCH_SETTLE    (400)   /*!< Samples skipped before measuring */
+#define BENCH_AMPLITUDE (300.0) /*!< Mains amplitude in ADC counts */
+#define BENCH_WINDOW    (2000)  /*!< Detector block */
+#define BENCH_REPEAT    (20)    /*!< Passes over the record for cost */
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief One interference case.
+ */
+typedef struct
+{
+    double mains_hz;   /**< Injected frequency */
+    NotchMains notch;  /**< Notch setting */
+} bench_case_t;
+
+/* Private variables -------------------------------------------------- */
+static const bench_case_t cases[] = {
+    {50.0, NOTCH_MAINS_50HZ},
+    {50.2, NOTCH_MAINS_50HZ},
+    {60.0, NOTCH_MAINS_60HZ},
+    {59.8, NOTCH_MAINS_60HZ},
+};
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Run the firmware chain on a signal.
+ *
+ * @param[in]   in     Input samples.
+ * @param[out]  out    Output samples.
+ * @param[in]   n      Number of samples.
+ * @param[in]   notch  Notch setting, or -1 for the Bandpass Filter alone.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void run_chain(const int32_t *in, int32_t *out, size_t n, int notch);
+
+/**
+ * @brief  RMS of a - b (of a when b is NULL) from BENCH_SETTLE on.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - RMS difference
+ */
+static double rms_diff(const int32_t *a, const int32_t *b, size_t n);
+
+/**
+ * @brief  Detector peaks summed over all whole windows.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of peaks
+ */
+static uint32_t count_peaks(int32_t *signal, size_t n);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    int32_t *record = mitbih_load(path, 2, 0, &n);
+    if (record == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    int32_t *clean = malloc(n * sizeof(int32_t));
+    int32_t *noisy = malloc(n * sizeof(int32_t));
+    int32_t *bp_clean = malloc(n * sizeof(int32_t));
+    int32_t *bp_noisy = malloc(n * sizeof(int32_t));
+    int32_t *nt_clean = malloc(n * sizeof(int32_t));
+    int32_t *nt_noisy = malloc(n * sizeof(int32_t));
+
+    for (size_t i = 0; i < n; i++)
+        clean[i] = record[i] * 2;
+    run_chain(clean, bp_clean, n, -1);
+
+    printf("{\n  \"benchmark\": \"mains_notch\",\n  \"samples\": %zu,\n", n);
+    printf("  \"mains_amplitude\": %.0f,\n  \"peaks_clean\": %u,\n  \"results\": [\n", BENCH_AMPLITUDE,
+           count_peaks(bp_clean, n));
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        double w = 2.0 * M_PI * cases[c].mains_hz / BENCH_FS;
+        for (size_t i = 0; i < n; i++)
+            noisy[i] = clean[i] + (int32_t)lrint(BENCH_AMPLITUDE * sin(w * (double)i + 0.3));
+
+        run_chain(noisy, bp_noisy, n, -1);
+        run_chain(clean, nt_clean, n, cases[c].notch);
+        run_chain(noisy, nt_noisy, n, cases[c].notch);
+
+        double before = rms_diff(bp_noisy, bp_clean, n);
+        double after = rms_diff(nt_noisy, nt_clean, n);
+        double distortion = rms_diff(nt_clean, bp_clean, n);
+        double ecg = rms_diff(bp_clean, NULL, n);
+
+        printf("    {\"mains_hz\": %.1f, \"notch_hz\": %d, \"residual_rms_bandpass\": %.1f, "
+               "\"residual_rms_notch\": %.2f, \"attenuation_db\": %.1f, \"ecg_change_db\": %.1f, "
+               "\"peaks_bandpass\": %u, \"peaks_notch\": %u}%s\n",
+               cases[c].mains_hz, cases[c].notch == NOTCH_MAINS_60HZ ? 60 : 50, before, after,
+               20.0 * log10(after / before), 20.0 * log10(distortion / ecg), count_peaks(bp_noisy, n),
+               count_peaks(nt_noisy, n), (c + 1 < sizeof(cases) / sizeof(cases[0])) ? "," : "");
+    }
+
+    /* Cost of the ISR chain, one call pair per sample */
+    BandpassFilter bandpass;
+    NotchFilter notch;
+    volatile int32_t sink = 0;
+    uint64_t t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilter_Init(&bandpass);
+        for (size_t i = 0; i < n; i++)
+            sink += BandpassFilter_Apply(&bandpass, noisy[i]);
+    }
+    double bp_cost = (double)(__rdtsc() - t0) / ((double)n * BENCH_REPEAT);
+
+    t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        BandpassFilter_Init(&bandpass);
+        NotchFilter_Init(&notch, NOTCH_MAINS_60HZ);
+        for (size_t i = 0; i < n; i++)
+            sink += NotchFilter_Apply(&notch, BandpassFilter_Apply(&bandpass, noisy[i]));
+    }
+    double chain_cost = (double)(__rdtsc() - t0) / ((double)n * BENCH_REPEAT);
+
+    printf("  ],\n  \"cycles_bandpass\": %.2f,\n  \"cycles_bandpass_notch\": %.2f\n}\n", bp_cost, chain_cost);
+
+    free(record);
+    free(clean);
+    free(noisy);
+    free(bp_clean);
+    free(bp_noisy);
+    free(nt_clean);
+    free(nt_noisy);
+    return 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void run_chain(const int32_t *in, int32_t *out, size_t n, int notch)
+{
+    BandpassFilter bandpass;
+    NotchFilter filter;
+    BandpassFilter_Init(&bandpass);
+    BandpassFilter_ApplyBlock(&bandpass, in, out, n);
+    if (notch < 0)
+        return;
+
+    NotchFilter_Init(&filter, (NotchMains)notch);
+    for (size_t i = 0; i < n; i++)
+        out[i] = NotchFilter_Apply(&filter, out[i]);
+}
+
+static double rms_diff(const int32_t *a, const int32_t *b, size_t n)
+{
+    double sum = 0;
+    for (size_t i = BENCH_SETTLE; i < n; i++)
+    {
+        double d = (double)a[i] - (b != NULL ? (double)b[i] : 0.0);
+        sum += d * d;
+    }
+    return sqrt(sum / (double)(n - BENCH_SETTLE));
+}
+
+static uint32_t count_peaks(int32_t *signal, size_t n)
+{
+    static uint8_t flags[BENCH_WINDOW];
+    QRSDetector detector;
+    uint32_t peaks = 0;
+    for (size_t i = 0; i + BENCH_WINDOW <= n; i += BENCH_WINDOW)
+    {
+        QRSDetector_Detect(&detector, &signal[i], flags);
+        peaks += detector.peak_count;
+    }
+    return peaks;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,179 @@
+/**
+ * @file       pan_tompkins_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Se/PPV and cost of the fixed-point Pan-Tompkins detector on
+ *             record 100, next to the static-threshold QRSDetector_Push.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 -I evaluate/native evaluate/bench/pan_tompkins_bench.c
+ *                 evaluate/native/resample.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/pan_tompkins.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -lm -o pan_tompkins_bench
+ *             ./pan_tompkins_bench [evaluate/data/100] [gain]
+ *             Same input path as qrs_stream_bench: MLII resampled to
+ *             200 Hz, stretched to 0..4095, BandpassFilter_Apply. The
+ *             optional gain scales the signal around mid-range first, to
+ *             show which detector depends on the amplitude. Cycles cover
+ *             the detector only, per sample, x86 TSC.
+ * @example    pan_tompkins_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "pan_tompkins.h"
+#include "qrs_detector.h"
+#include "resample.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_FS        (200) /*!< Firmware sample rate */
+#define BENCH_TOLERANCE (10)  /*!< Match window, as evaluate_filter.py */
+#define BENCH_REPEAT    (5)   /*!< Passes for the cost */
+
+/* Private variables -------------------------------------------------- */
+static PanTompkins pt;
+static QRSDetector detector;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Detector adapters with one signature.
+ *
+ * @attention  Internal functions, not for direct use.
+ *
+ * @return
+ *  - 1 when peak was filled
+ */
+static void bench_init_pt(void);
+static uint8_t bench_push_pt(int32_t sample, QRSPeak *peak);
+static void bench_init_static(void);
+static uint8_t bench_push_static(int32_t sample, QRSPeak *peak);
+
+/**
+ * @brief  Run one detector over the signal, score it and print a JSON object.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_run(const char *name, void (*init)(void), uint8_t (*push)(int32_t, QRSPeak *),
+                      const int32_t *signal, size_t n, const uint32_t *beats, size_t nbeats, const char *tail);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *record = (argc > 1) ? argv[1] : "evaluate/data/100";
+    const double gain = (argc > 2) ? atof(argv[2]) : 1.0;
+    char path[256];
+    size_t n_in = 0;
+    size_t nbeats = 0;
+
+    snprintf(path, sizeof(path), "%s.dat", record);
+    int32_t *raw = mitbih_load(path, 2, 0, &n_in);
+    snprintf(path, sizeof(path), "%s.atr", record);
+    uint32_t *beats = mitbih_load_beats(path, &nbeats);
+    Resampler rs;
+    if (raw == NULL || beats == NULL || Resampler_Init(&rs, BENCH_FS, MITBIH_FS) != RESAMPLER_SUCCESS)
+    {
+        fprintf(stderr, "cannot read %s\n", record);
+        return 2;
+    }
+
+    int32_t *signal = malloc(Resampler_MaxOutput(&rs, n_in + rs.taps) * sizeof(int32_t));
+    size_t n = Resampler_Process(&rs, raw, signal, n_in);
+    n += Resampler_Flush(&rs, signal + n);
+    mitbih_to_adc(signal, n);
+    BandpassFilter filter;
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < n; i++)
+        signal[i] = BandpassFilter_Apply(&filter, (int32_t)(2048 + (signal[i] - 2048) * gain));
+    for (size_t b = 0; b < nbeats; b++)
+        beats[b] = (uint32_t)(((uint64_t)beats[b] * BENCH_FS + MITBIH_FS / 2) / MITBIH_FS);
+
+    printf("{\n  \"benchmark\": \"pan_tompkins\",\n  \"samples\": %zu,\n  \"beats\": %zu,\n  \"gain\": %.2f,\n", n,
+           nbeats, gain);
+    printf("  \"state_bytes\": {\"pan_tompkins\": %zu, \"qrs_stream\": %zu},\n", sizeof(PanTompkins),
+           sizeof(QRSDetector));
+    bench_run("pan_tompkins", bench_init_pt, bench_push_pt, signal, n, beats, nbeats, ",");
+    bench_run("qrs_stream", bench_init_static, bench_push_static, signal, n, beats, nbeats, "");
+    printf("}\n");
+
+    Resampler_Free(&rs);
+    free(raw);
+    free(beats);
+    free(signal);
+    return 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void bench_init_pt(void)
+{
+    PanTompkins_Init(&pt);
+}
+
+static uint8_t bench_push_pt(int32_t sample, QRSPeak *peak)
+{
+    return PanTompkins_Push(&pt, sample, peak);
+}
+
+static void bench_init_static(void)
+{
+    QRSDetector_Init(&detector);
+}
+
+static uint8_t bench_push_static(int32_t sample, QRSPeak *peak)
+{
+    return QRSDetector_Push(&detector, sample, peak);
+}
+
+static void bench_run(const char *name, void (*init)(void), uint8_t (*push)(int32_t, QRSPeak *),
+                      const int32_t *signal, size_t n, const uint32_t *beats, size_t nbeats, const char *tail)
+{
+    uint32_t *found = malloc(n * sizeof(uint32_t));
+    size_t nfound = 0;
+    uint32_t max_latency = 0;
+    QRSPeak peak;
+
+    init();
+    for (size_t i = 0; i < n; i++)
+    {
+        if (push(signal[i], &peak))
+        {
+            found[nfound++] = peak.index;
+            if (i - peak.index > max_latency)
+                max_latency = (uint32_t)(i - peak.index);
+        }
+    }
+
+    uint32_t sink = 0;
+    uint64_t t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        init();
+        for (size_t i = 0; i < n; i++)
+            sink += push(signal[i], &peak);
+    }
+    double cycles = (double)(__rdtsc() - t0) / ((double)n * BENCH_REPEAT);
+
+    mitbih_score_t score = mitbih_score(found, nfound, beats, nbeats, BENCH_TOLERANCE);
+    printf("  \"%s\": {\"detections\": %zu, \"tp\": %zu, \"fp\": %zu, \"fn\": %zu, \"se\": %.4f, \"ppv\": %.4f, "
+           "\"max_latency_samples\": %u, \"cycles_per_sample\": %.1f}%s\n",
+           name, nfound, score.tp, score.fp, score.fn, score.se, score.ppv, max_latency, cycles, tail);
+    free(found);
+    (void)sink;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,227 @@
+/**
+ * @file       qrs_detect_check.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host check that QRSDetector_Detect gives the same flags as the
+ *             original version with 2000-entry candidate arrays on the stack.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 -I evaluate/native evaluate/bench/qrs_detect_check.c
+ *                 evaluate/native/resample.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -lm -o qrs_detect_check
+ *             ./qrs_detect_check [evaluate/data/100]
+ *             Inputs: record 100 resampled and stretched to ADC range as
+ *             evaluate_filter.py does, the raw record fed as 200 Hz, and a
+ *             noisy 180 bpm synthetic signal that fills the
+ *             QRS_MAX_PEAKS candidate limit in every block. Exit status
+ *             is 0 when every block matches.
+ * @example    qrs_detect_check.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "qrs_detector.h"
+#include "resample.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private defines ---------------------------------------------------- */
+#define CHECK_BLOCK (2000) /*!< QRSDetector_Detect block */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  The original QRSDetector_Detect, trace calls removed.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of peaks
+ */
+static uint16_t reference_detect(int32_t *signal, uint8_t *qrs_flags);
+
+/**
+ * @brief  Compare both detectors on every whole block of a filtered signal.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of blocks that differ
+ */
+static size_t check_signal(const char *name, int32_t *signal, size_t n);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *record = (argc > 1) ? argv[1] : "evaluate/data/100";
+    char path[256];
+    size_t n_in = 0;
+    size_t failures = 0;
+    BandpassFilter filter;
+    Resampler rs;
+
+    snprintf(path, sizeof(path), "%s.dat", record);
+    int32_t *raw = mitbih_load(path, 2, 0, &n_in);
+    if (raw == NULL || Resampler_Init(&rs, 200, MITBIH_FS) != RESAMPLER_SUCCESS)
+    {
+        fprintf(stderr, "cannot read %s\n", record);
+        return 2;
+    }
+
+    /* evaluate_filter.py input path */
+    int32_t *signal = malloc((Resampler_MaxOutput(&rs, n_in + rs.taps) + n_in) * sizeof(int32_t));
+    size_t n = Resampler_Process(&rs, raw, signal, n_in);
+    n += Resampler_Flush(&rs, signal + n);
+    mitbih_to_adc(signal, n);
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < n; i++)
+        signal[i] = BandpassFilter_Apply(&filter, signal[i]);
+    failures += check_signal("resampled_adc", signal, n);
+
+    /* Raw record as the 200 Hz stream, as the older benches feed it */
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < n_in; i++)
+        signal[i] = BandpassFilter_Apply(&filter, raw[i] * 2);
+    failures += check_signal("raw_x2", signal, n_in);
+
+    /* 180 bpm spikes on uniform noise: dense candidates */
+    uint32_t seed = 12345;
+    n = 100 * CHECK_BLOCK;
+    for (size_t i = 0; i < n; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t noise = (int32_t)(seed >> 21) - 1024;
+        signal[i] = noise + ((i % 67) < 3 ? 2500 : 0);
+    }
+    failures += check_signal("dense_noise", signal, n);
+
+    Resampler_Free(&rs);
+    free(raw);
+    free(signal);
+    printf("%s\n", failures ? "FAIL" : "OK");
+    return failures ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static size_t check_signal(const char *name, int32_t *signal, size_t n)
+{
+    static QRSDetector detector;
+    uint8_t flags[CHECK_BLOCK];
+    uint8_t expected[CHECK_BLOCK];
+    size_t blocks = 0;
+    size_t peaks = 0;
+    size_t failures = 0;
+
+    for (size_t i = 0; i + CHECK_BLOCK <= n; i += CHECK_BLOCK)
+    {
+        uint16_t count = reference_detect(&signal[i], expected);
+        QRSDetector_Detect(&detector, &signal[i], flags);
+        if (count != detector.peak_count || memcmp(flags, expected, CHECK_BLOCK) != 0)
+            failures++;
+        blocks++;
+        peaks += count;
+    }
+
+    printf("%s: %zu blocks, %zu peaks, %zu mismatched blocks\n", name, blocks, peaks, failures);
+    return failures;
+}
+
+static uint16_t reference_detect(int32_t *signal, uint8_t *qrs_flags)
+{
+    uint16_t peak_count = 0;
+    for (uint16_t i = 0; i < 2000; i++) {
+        qrs_flags[i] = 0;
+    }
+
+    int64_t signal_sum = 0;
+    for (uint16_t i = 0; i < 2000; i++) {
+        signal_sum += signal[i];
+    }
+    int32_t signal_mean = (int32_t)(signal_sum / 2000);
+
+    uint16_t potential_peaks[2000];
+    int32_t potential_values[2000];
+    uint16_t potential_count = 0;
+
+    for (uint16_t i = 0; i < 2000; i++) {
+        int32_t adjusted_signal = signal[i] - signal_mean;
+        if (adjusted_signal > QRS_STATIC_THRESHOLD && adjusted_signal > 0 && potential_count < QRS_MAX_PEAKS) {
+            int32_t is_peak = 1;
+            for (uint16_t j = 1; j <= QRS_PEAK_WINDOW; j++) {
+                if (i >= j && adjusted_signal < (signal[i - j] - signal_mean)) {
+                    is_peak = 0;
+                    break;
+                }
+                if (i + j < 2000 && adjusted_signal < (signal[i + j] - signal_mean)) {
+                    is_peak = 0;
+                    break;
+                }
+            }
+            if (is_peak) {
+                potential_peaks[potential_count] = i;
+                potential_values[potential_count] = adjusted_signal;
+                potential_count++;
+                i += QRS_PEAK_WINDOW;
+            }
+        }
+    }
+
+    uint16_t min_distance = QRS_MIN_DISTANCE;
+    if (potential_count > 1) {
+        int32_t total_interval = potential_peaks[potential_count - 1] - potential_peaks[0];
+        int32_t avg_interval = total_interval / (potential_count - 1);
+        min_distance = (uint16_t)(avg_interval / 2);
+        if (min_distance < 30) min_distance = 30;
+        if (min_distance > QRS_MIN_DISTANCE) min_distance = QRS_MIN_DISTANCE;
+    }
+
+    for (uint16_t i = 0; i < potential_count; i++) {
+        uint16_t start_idx = potential_peaks[i];
+        uint16_t end_idx = start_idx + min_distance;
+        if (end_idx >= 2000) end_idx = 1999;
+
+        int32_t max_value = potential_values[i];
+        uint16_t max_idx = start_idx;
+
+        for (uint16_t j = i + 1; j < potential_count; j++) {
+            if (potential_peaks[j] > end_idx) break;
+            if (potential_values[j] > max_value) {
+                max_value = potential_values[j];
+                max_idx = potential_peaks[j];
+            }
+            i = j;
+        }
+
+        uint16_t refine_start = (max_idx < QRS_PEAK_REFINE_WINDOW) ? 0 : max_idx - QRS_PEAK_REFINE_WINDOW;
+        uint16_t refine_end = (max_idx + QRS_PEAK_REFINE_WINDOW >= 2000) ? 1999 : max_idx + QRS_PEAK_REFINE_WINDOW;
+        int32_t refined_max_value = signal[max_idx] - signal_mean;
+        uint16_t refined_max_idx = max_idx;
+
+        for (uint16_t j = refine_start; j <= refine_end; j++) {
+            int32_t value = signal[j] - signal_mean;
+            if (value > refined_max_value) {
+                refined_max_value = value;
+                refined_max_idx = j;
+            }
+        }
+
+        if (refined_max_value > QRS_MIN_AMPLITUDE && peak_count < QRS_MAX_PEAKS) {
+            qrs_flags[refined_max_idx] = 1;
+            peak_count++;
+        }
+    }
+
+    return peak_count;
+}
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,193 @@
+/**
+ * @file       qrs_merge_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Cost of the QRS candidate merge as candidates get denser.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/qrs_merge_bench.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o qrs_merge_bench
+ *             ./qrs_merge_bench
+ *             Synthetic beats on noise, each beat two spikes 6 samples
+ *             apart so every group merges two candidates. Part one runs
+ *             QRSDetector_Detect on 2000-sample blocks with 2 to
+ *             QRS_MAX_PEAKS candidates and fits a line to cycles per
+ *             block; no point may sit more than BENCH_LINE_TOLERANCE above
+ *             it. Part two runs
+ *             QRSDetector_DetectRecord at 200 bpm on records from 80 s to
+ *             23 h; cycles per sample must stay flat, and only the beats
+ *             merged while the RR average settles may be missed. Exit
+ *             status is 1 when either cost leaves its bound or a beat is
+ *             missed.
+ * @example    qrs_merge_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "qrs_detector.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_BLOCK          (2000) /*!< QRSDetector_Detect block */
+#define BENCH_BASE           (2048) /*!< Mid-scale ADC code */
+#define BENCH_SPIKE          (1800) /*!< Main spike above the base */
+#define BENCH_ECHO           (1400) /*!< Second spike of the same beat */
+#define BENCH_ECHO_OFFSET    (6)    /*!< Samples between the two spikes */
+#define BENCH_NOISE          (40)   /*!< Peak uniform noise */
+#define BENCH_FAST_RR        (60)   /*!< 200 bpm at 200 Hz */
+#define BENCH_REPEAT         (2000) /*!< Detect calls per point */
+#define BENCH_LINEAR_RATIO   (2.0)  /*!< Largest growth of cycles per sample */
+#define BENCH_LINE_TOLERANCE (0.15) /*!< Largest block cost above the fitted line */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Fill a signal with noisy two-spike beats.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of beats written
+ */
+static uint32_t bench_synth(int32_t *signal, size_t n, uint32_t rr);
+
+/**
+ * @brief  Fewest cycles of BENCH_REPEAT QRSDetector_Detect calls.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Cycles per call
+ */
+static double bench_detect(QRSDetector *detector, int32_t *signal, uint8_t *flags);
+
+/* Function definitions ----------------------------------------------- */
+int main(void)
+{
+    static QRSDetector detector;
+    static int32_t block[BENCH_BLOCK];
+    static uint8_t flags[BENCH_BLOCK];
+    int failures = 0;
+
+    /* Part one: one block, more and more candidates */
+    const uint32_t beats_max = QRS_MAX_PEAKS / 2;
+    double cycles[QRS_MAX_PEAKS / 2 + 1];
+    printf("{\n  \"benchmark\": \"qrs_merge\",\n  \"block\": [\n");
+    for (uint32_t b = 1; b <= beats_max; b++)
+    {
+        uint32_t beats = bench_synth(block, BENCH_BLOCK, BENCH_BLOCK / b);
+        cycles[b] = bench_detect(&detector, block, flags);
+        if (detector.peak_count != beats)
+            failures++;
+        printf("    {\"candidates\": %u, \"peaks\": %u, \"cycles\": %.0f}%s\n", 2 * beats, detector.peak_count,
+               cycles[b], b < beats_max ? "," : "");
+    }
+    /* Least-squares line through cycles against candidates */
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (uint32_t b = 1; b <= beats_max; b++)
+    {
+        sx += 2.0 * b;
+        sy += cycles[b];
+        sxx += 4.0 * b * b;
+        sxy += 2.0 * b * cycles[b];
+    }
+    double slope = (beats_max * sxy - sx * sy) / (beats_max * sxx - sx * sx);
+    double intercept = (sy - slope * sx) / beats_max;
+    double worst = 0;
+    for (uint32_t b = 1; b <= beats_max; b++)
+    {
+        double residual = (cycles[b] - (intercept + slope * 2.0 * b)) / cycles[b];
+        if (residual > worst)
+            worst = residual;
+    }
+    printf("  ],\n  \"block_fit\": {\"cycles\": %.0f, \"cycles_per_candidate\": %.1f, \"worst_above_line\": %.3f},\n",
+           intercept, slope, worst);
+    if (worst > BENCH_LINE_TOLERANCE)
+        failures++;
+
+    /* Part two: 200 bpm records of growing length */
+    const size_t longest = (size_t)BENCH_BLOCK << 13;
+    int32_t *signal = malloc(longest * sizeof(int32_t));
+    uint32_t *peaks = malloc((longest / BENCH_FAST_RR + 1) * sizeof(uint32_t));
+    double first = 0;
+    double last = 0;
+    int64_t first_missed = -1;
+    printf("  \"record\": [\n");
+    for (size_t n = (size_t)BENCH_BLOCK << 3; n <= longest; n <<= 2)
+    {
+        uint32_t beats = bench_synth(signal, n, BENCH_FAST_RR);
+        uint64_t t0 = __rdtsc();
+        uint32_t count = QRSDetector_DetectRecord(&detector, signal, (uint32_t)n, peaks,
+                                                  (uint32_t)(longest / BENCH_FAST_RR + 1));
+        double per_sample = (double)(__rdtsc() - t0) / (double)n;
+        /* Beats merged while the RR average settles from its 160-sample start */
+        if (first_missed < 0)
+            first_missed = (int64_t)beats - count;
+        if ((int64_t)beats - count != first_missed)
+            failures++;
+        if (first == 0)
+            first = per_sample;
+        last = per_sample;
+        printf("    {\"samples\": %zu, \"beats\": %u, \"peaks\": %u, \"cycles_per_sample\": %.2f}%s\n", n, beats,
+               count, per_sample, n * 4 <= longest ? "," : "");
+    }
+    if (last > BENCH_LINEAR_RATIO * first)
+        failures++;
+    printf("  ],\n  \"settling_misses\": %lld,\n  \"failures\": %d\n}\n", (long long)first_missed, failures);
+
+    free(signal);
+    free(peaks);
+    return failures ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint32_t bench_synth(int32_t *signal, size_t n, uint32_t rr)
+{
+    uint32_t seed = 12345;
+    uint32_t beats = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        signal[i] = BENCH_BASE + (int32_t)(seed >> 16) % (2 * BENCH_NOISE + 1) - BENCH_NOISE;
+    }
+
+    /* Triangles: the apex and the echo apex are the only local maxima */
+    for (size_t t = rr / 2; t + BENCH_ECHO_OFFSET + 3 < n; t += rr)
+    {
+        for (int32_t d = -3; d <= 3; d++)
+        {
+            int32_t w = 3 - (d < 0 ? -d : d);
+            signal[t + d] += BENCH_SPIKE * w / 3;
+            signal[t + BENCH_ECHO_OFFSET + d] += BENCH_ECHO * w / 3;
+        }
+        beats++;
+    }
+
+    return beats;
+}
+
+static double bench_detect(QRSDetector *detector, int32_t *signal, uint8_t *flags)
+{
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        uint64_t t0 = __rdtsc();
+        QRSDetector_Detect(detector, signal, flags);
+        uint64_t spent = __rdtsc() - t0;
+        if (spent < best)
+            best = spent;
+    }
+
+    return (double)best;
+}
+
+/* End of file -------------------------------------------------------- */
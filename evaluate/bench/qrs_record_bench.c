@@ -0,0 +1,174 @@
+/**
+ * @file       qrs_record_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      QRSDetector_DetectRecord on the full 30-minute record 100 and
+ *             on a 24 h record built by repeating it.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 -I evaluate/native evaluate/bench/qrs_record_bench.c
+ *                 evaluate/native/resample.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -lm -o qrs_record_bench
+ *             ./qrs_record_bench [evaluate/data/100]
+ *             The input path follows evaluate_filter.py: MLII resampled
+ *             to 200 Hz, stretched to 0..4095, then BandpassFilter_Apply.
+ *             Beats are scored one-to-one within 10 samples (50 ms). The
+ *             exit status is 1 when throughput is below BENCH_TARGET_MSPS,
+ *             the last copy of the 24 h run scores below the single
+ *             record, or a short output buffer changes the count.
+ * @example    qrs_record_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "qrs_detector.h"
+#include "resample.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_FS          (200)   /*!< Firmware sample rate */
+#define BENCH_TOLERANCE   (10)    /*!< Match window, as evaluate_filter.py */
+#define BENCH_WINDOW      (24000) /*!< GUI window, 120 s */
+#define BENCH_DAY_COPIES  (48)    /*!< 48 x 30 min = 24 h */
+#define BENCH_REPEAT      (10)    /*!< Passes over the 30-minute record */
+#define BENCH_TARGET_MSPS (50.0)  /*!< Lower bound on throughput */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *record = (argc > 1) ? argv[1] : "evaluate/data/100";
+    char path[256];
+    size_t n_in = 0;
+    size_t nbeats = 0;
+
+    snprintf(path, sizeof(path), "%s.dat", record);
+    int32_t *raw = mitbih_load(path, 2, 0, &n_in);
+    snprintf(path, sizeof(path), "%s.atr", record);
+    uint32_t *beats = mitbih_load_beats(path, &nbeats);
+    Resampler rs;
+    if (raw == NULL || beats == NULL || Resampler_Init(&rs, BENCH_FS, MITBIH_FS) != RESAMPLER_SUCCESS)
+    {
+        fprintf(stderr, "cannot read %s\n", record);
+        return 2;
+    }
+
+    int32_t *signal = malloc(Resampler_MaxOutput(&rs, n_in + rs.taps) * sizeof(int32_t));
+    size_t n = Resampler_Process(&rs, raw, signal, n_in);
+    n += Resampler_Flush(&rs, signal + n);
+    mitbih_to_adc(signal, n);
+    BandpassFilter filter;
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < n; i++)
+        signal[i] = BandpassFilter_Apply(&filter, signal[i]);
+    for (size_t b = 0; b < nbeats; b++)
+        beats[b] = (uint32_t)(((uint64_t)beats[b] * BENCH_FS + MITBIH_FS / 2) / MITBIH_FS);
+
+    /* Full record, one call */
+    static QRSDetector detector;
+    const uint32_t capacity = (uint32_t)(n / QRS_MIN_DISTANCE_FLOOR + 1);
+    uint32_t *peaks = malloc(capacity * sizeof(uint32_t));
+    uint32_t count = QRSDetector_DetectRecord(&detector, signal, (uint32_t)n, peaks, capacity);
+    mitbih_score_t score = mitbih_score(peaks, count, beats, nbeats, BENCH_TOLERANCE);
+
+    uint32_t sink = 0;
+    uint64_t c0 = __rdtsc();
+    uint64_t t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+        sink += QRSDetector_DetectRecord(&detector, signal, (uint32_t)n, peaks, capacity);
+    double record_ns = (double)(bench_now() - t0);
+    double record_cycles = (double)(__rdtsc() - c0) / ((double)n * BENCH_REPEAT);
+
+    /* A short buffer keeps the count and the first entries */
+    uint32_t short_peaks[QRS_MAX_PEAKS];
+    uint32_t short_count = QRSDetector_DetectRecord(&detector, signal, (uint32_t)n, short_peaks, QRS_MAX_PEAKS);
+    int short_ok = short_count == count && memcmp(short_peaks, peaks, sizeof(short_peaks)) == 0;
+
+    /* Most beats in any 120 s GUI window */
+    uint32_t window_max = 0;
+    for (uint32_t first = 0, last = 0; last < count; last++)
+    {
+        while (peaks[last] - peaks[first] >= BENCH_WINDOW)
+            first++;
+        if (last - first + 1 > window_max)
+            window_max = last - first + 1;
+    }
+
+    /* 24 h: the record repeated, in one call */
+    const size_t day = n * BENCH_DAY_COPIES;
+    int32_t *holter = malloc(day * sizeof(int32_t));
+    for (size_t k = 0; k < BENCH_DAY_COPIES; k++)
+        memcpy(holter + k * n, signal, n * sizeof(int32_t));
+    const uint32_t day_capacity = (uint32_t)(day / QRS_MIN_DISTANCE_FLOOR + 1);
+    uint32_t *day_peaks = malloc(day_capacity * sizeof(uint32_t));
+    t0 = bench_now();
+    uint32_t day_count = QRSDetector_DetectRecord(&detector, holter, (uint32_t)day, day_peaks, day_capacity);
+    double day_ns = (double)(bench_now() - t0);
+
+    /* Score the last copy; it starts from a settled detector, not a cold one */
+    const uint32_t day_offset = (uint32_t)(n * (BENCH_DAY_COPIES - 1));
+    uint32_t day_first = 0;
+    while (day_first < day_count && day_peaks[day_first] < day_offset)
+        day_first++;
+    for (uint32_t i = day_first; i < day_count; i++)
+        day_peaks[i] -= day_offset;
+    mitbih_score_t day_score = mitbih_score(day_peaks + day_first, day_count - day_first, beats, nbeats,
+                                            BENCH_TOLERANCE);
+
+    double msps = (double)n * BENCH_REPEAT * 1e3 / record_ns;
+    double day_msps = (double)day * 1e3 / day_ns;
+
+    printf("{\n  \"benchmark\": \"qrs_record\",\n  \"state_bytes\": %zu,\n", sizeof(QRSDetector));
+    printf("  \"record\": {\"samples\": %zu, \"beats\": %zu, \"detections\": %u, \"tp\": %zu, \"fp\": %zu, "
+           "\"fn\": %zu, \"se\": %.4f, \"ppv\": %.4f, \"msamples_per_s\": %.1f, \"cycles_per_sample\": %.1f},\n",
+           n, nbeats, count, score.tp, score.fp, score.fn, score.se, score.ppv, msps, record_cycles);
+    printf("  \"max_beats_per_120s\": %u,\n  \"block_cap\": %d,\n  \"short_buffer_ok\": %s,\n", window_max,
+           QRS_MAX_PEAKS, short_ok ? "true" : "false");
+    printf("  \"day\": {\"samples\": %zu, \"detections\": %u, \"last_copy_se\": %.4f, \"last_copy_ppv\": %.4f, "
+           "\"msamples_per_s\": %.1f}\n}\n",
+           day, day_count, day_score.se, day_score.ppv, day_msps);
+
+    Resampler_Free(&rs);
+    free(raw);
+    free(beats);
+    free(signal);
+    free(peaks);
+    free(holter);
+    free(day_peaks);
+    return (sink == 0 || !short_ok || day_score.se < score.se || day_score.ppv < score.ppv ||
+            msps < BENCH_TARGET_MSPS || day_msps < BENCH_TARGET_MSPS) ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* End of file -------------------------------------------------------- */
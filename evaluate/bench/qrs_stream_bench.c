@@ -0,0 +1,170 @@
+/**
+ * @file       qrs_stream_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Streaming QRSDetector_Push against the 2000-sample block
+ *             QRSDetector_Detect on all of record 100.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 -I evaluate/native evaluate/bench/qrs_stream_bench.c
+ *                 evaluate/native/resample.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -lm -o qrs_stream_bench
+ *             ./qrs_stream_bench [evaluate/data/100]
+ *             The input path follows evaluate_filter.py: MLII resampled
+ *             to 200 Hz, stretched to 0..4095, then BandpassFilter_Apply.
+ *             Beats are scored one-to-one within 10 samples (50 ms).
+ *             Latency is the push count between a peak's sample and the
+ *             push that reports it; for the block detector it is the
+ *             distance to the end of the block.
+ * @example    qrs_stream_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "qrs_detector.h"
+#include "resample.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_FS        (200)  /*!< Firmware sample rate */
+#define BENCH_BLOCK     (2000) /*!< QRSDetector_Detect block */
+#define BENCH_TOLERANCE (10)   /*!< Match window, as evaluate_filter.py */
+#define BENCH_REPEAT    (5)    /*!< Passes for the cost */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Print one detector's result as a JSON object.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_report(const char *name, const mitbih_score_t *score, size_t detections, uint32_t max_latency,
+                         double cycles, const char *tail);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *record = (argc > 1) ? argv[1] : "evaluate/data/100";
+    char path[256];
+    size_t n_in = 0;
+    size_t nbeats = 0;
+
+    snprintf(path, sizeof(path), "%s.dat", record);
+    int32_t *raw = mitbih_load(path, 2, 0, &n_in);
+    snprintf(path, sizeof(path), "%s.atr", record);
+    uint32_t *beats = mitbih_load_beats(path, &nbeats);
+    Resampler rs;
+    if (raw == NULL || beats == NULL || Resampler_Init(&rs, BENCH_FS, MITBIH_FS) != RESAMPLER_SUCCESS)
+    {
+        fprintf(stderr, "cannot read %s\n", record);
+        return 2;
+    }
+
+    int32_t *signal = malloc(Resampler_MaxOutput(&rs, n_in + rs.taps) * sizeof(int32_t));
+    size_t n = Resampler_Process(&rs, raw, signal, n_in);
+    n += Resampler_Flush(&rs, signal + n);
+    mitbih_to_adc(signal, n);
+    BandpassFilter filter;
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < n; i++)
+        signal[i] = BandpassFilter_Apply(&filter, signal[i]);
+    for (size_t b = 0; b < nbeats; b++)
+        beats[b] = (uint32_t)(((uint64_t)beats[b] * BENCH_FS + MITBIH_FS / 2) / MITBIH_FS);
+
+    /* Block detector, whole blocks only */
+    static QRSDetector detector;
+    uint8_t *flags = malloc(BENCH_BLOCK);
+    uint32_t *batch = malloc(n * sizeof(uint32_t));
+    size_t nbatch = 0;
+    uint32_t batch_latency = 0;
+    const size_t covered = n - n % BENCH_BLOCK;
+    uint64_t t0 = __rdtsc();
+    for (size_t i = 0; i < covered; i += BENCH_BLOCK)
+    {
+        QRSDetector_Detect(&detector, &signal[i], flags);
+        for (uint32_t k = 0; k < BENCH_BLOCK; k++)
+        {
+            if (flags[k])
+            {
+                batch[nbatch++] = (uint32_t)i + k;
+                if (BENCH_BLOCK - 1 - k > batch_latency)
+                    batch_latency = BENCH_BLOCK - 1 - k;
+            }
+        }
+    }
+    double batch_cycles = (double)(__rdtsc() - t0) / (double)covered;
+
+    /* Streaming detector over the same samples */
+    uint32_t *stream = malloc(n * sizeof(uint32_t));
+    size_t nstream = 0;
+    uint32_t stream_latency = 0;
+    QRSPeak peak;
+    QRSDetector_Init(&detector);
+    for (size_t i = 0; i < covered; i++)
+    {
+        if (QRSDetector_Push(&detector, signal[i], &peak))
+        {
+            stream[nstream++] = peak.index;
+            if (i - peak.index > stream_latency)
+                stream_latency = (uint32_t)(i - peak.index);
+        }
+    }
+
+    uint32_t sink = 0;
+    t0 = __rdtsc();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        QRSDetector_Init(&detector);
+        for (size_t i = 0; i < covered; i++)
+            sink += QRSDetector_Push(&detector, signal[i], &peak);
+    }
+    double stream_cycles = (double)(__rdtsc() - t0) / ((double)covered * BENCH_REPEAT);
+
+    size_t nref = 0;
+    while (nref < nbeats && beats[nref] < covered)
+        nref++;
+    mitbih_score_t batch_score = mitbih_score(batch, nbatch, beats, nref, BENCH_TOLERANCE);
+    mitbih_score_t stream_score = mitbih_score(stream, nstream, beats, nref, BENCH_TOLERANCE);
+
+    printf("{\n  \"benchmark\": \"qrs_stream\",\n  \"samples\": %zu,\n  \"beats\": %zu,\n", covered, nref);
+    printf("  \"stream_state_bytes\": %zu,\n  \"stream_latency_bound\": %d,\n", sizeof(QRSDetector),
+           QRS_STREAM_LATENCY);
+    bench_report("block_detect", &batch_score, nbatch, batch_latency, batch_cycles, ",");
+    bench_report("stream_push", &stream_score, nstream, stream_latency, stream_cycles, "");
+    printf("}\n");
+
+    Resampler_Free(&rs);
+    free(raw);
+    free(beats);
+    free(signal);
+    free(flags);
+    free(batch);
+    free(stream);
+    return (sink == 0 || stream_latency > QRS_STREAM_LATENCY) ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static void bench_report(const char *name, const mitbih_score_t *score, size_t detections, uint32_t max_latency,
+                         double cycles, const char *tail)
+{
+    printf("  \"%s\": {\"detections\": %zu, \"tp\": %zu, \"fp\": %zu, \"fn\": %zu, \"se\": %.4f, \"ppv\": %.4f, "
+           "\"max_latency_samples\": %u, \"cycles_per_sample\": %.1f}%s\n",
+           name, detections, score->tp, score->fp, score->fn, score->se, score->ppv, max_latency, cycles, tail);
+}
+
+/* End of file -------------------------------------------------------- */
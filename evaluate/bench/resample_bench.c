@@ -0,0 +1,329 @@
+/**
+ * @file       resample_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Streaming polyphase resampler against the FFT resample used by
+ *             evaluate_filter.py, 360 Hz to 200 Hz on all of record 100.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 -I evaluate/native evaluate/bench/resample_bench.c
+ *                 evaluate/native/resample.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -lm -o resample_bench
+ *             ./resample_bench [evaluate/data/100.dat]
+ *             The reference is the scipy.signal.resample algorithm (one
+ *             DFT of the whole record, spectrum truncated, inverse DFT)
+ *             written out here with a Bluestein FFT, since scipy is not a
+ *             dependency of the benches. It needs the whole record in
+ *             memory; the resampler is fed in 360-sample chunks, as a
+ *             stream from a database would arrive. Difference is reported
+ *             away from the ends, where the FFT wraps around, on the raw
+ *             output and after the firmware Bandpass Filter. The raw
+ *             difference is mostly the 80-100 Hz band, which the FFT keeps
+ *             and the resampler's transition band rolls off.
+ * @example    resample_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "resample.h"
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_FS_IN  (360)  /*!< MIT-BIH sample rate */
+#define BENCH_FS_OUT (200)  /*!< Firmware sample rate */
+#define BENCH_CHUNK  (360)  /*!< Input samples per Resampler_Process call */
+#define BENCH_EDGE   (400)  /*!< Output samples ignored at each end */
+#define BENCH_REPEAT (10)   /*!< Passes for the streaming timings */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/**
+ * @brief  In-place radix-2 FFT, size a power of two.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_fft(double complex *a, size_t size, int inverse);
+
+/**
+ * @brief  Unnormalized DFT of any length through Bluestein's algorithm.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Bytes of working memory used
+ */
+static size_t bench_dft(const double complex *in, double complex *out, size_t n, int inverse);
+
+/**
+ * @brief  scipy.signal.resample(x, num) for odd num.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Peak bytes of working memory
+ */
+static size_t bench_fft_resample(const int32_t *x, size_t n, double *y, size_t num);
+
+/**
+ * @brief  Resample a whole record through the streaming API in chunks.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of outputs
+ */
+static size_t bench_stream(Resampler *rs, const int32_t *x, size_t n, int32_t *y, size_t chunk);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "evaluate/data/100.dat";
+    size_t n = 0;
+    int32_t *x = mitbih_load(path, 2, 0, &n);
+    if (x == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    /* Same output length as evaluate_filter.py, odd for record 100 */
+    const size_t num = (size_t)((uint64_t)n * BENCH_FS_OUT / BENCH_FS_IN);
+    double *reference = malloc(num * sizeof(double));
+    int32_t *streamed = malloc((num + 8) * sizeof(int32_t));
+    int32_t *oneshot = malloc((num + 8) * sizeof(int32_t));
+    Resampler rs;
+    if (Resampler_Init(&rs, BENCH_FS_OUT, BENCH_FS_IN) != RESAMPLER_SUCCESS || (num & 1) == 0)
+    {
+        fprintf(stderr, "setup failed\n");
+        return 2;
+    }
+
+    uint64_t t0 = bench_now();
+    size_t fft_bytes = bench_fft_resample(x, n, reference, num);
+    double fft_ns = (double)(bench_now() - t0);
+
+    /* Chunked and one-shot must agree exactly */
+    size_t produced = bench_stream(&rs, x, n, oneshot, n);
+    size_t produced_chunked = bench_stream(&rs, x, n, streamed, BENCH_CHUNK);
+    size_t mismatches = (produced != produced_chunked);
+    for (size_t i = 0; i < produced && i < produced_chunked; i++)
+        mismatches += (oneshot[i] != streamed[i]);
+
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+        bench_stream(&rs, x, n, streamed, BENCH_CHUNK);
+    double stream_ns = (double)(bench_now() - t0) / BENCH_REPEAT;
+
+    /* Resampler feeding the firmware filter, ADC scaling as the other benches */
+    BandpassFilter filter;
+    int32_t chunk_out[BENCH_CHUNK];
+    int64_t checksum = 0;
+    t0 = bench_now();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+    {
+        Resampler_Reset(&rs);
+        BandpassFilter_Init(&filter);
+        for (size_t i = 0; i < n; i += BENCH_CHUNK)
+        {
+            size_t len = (n - i < BENCH_CHUNK) ? n - i : BENCH_CHUNK;
+            size_t m = Resampler_Process(&rs, x + i, chunk_out, len);
+            for (size_t k = 0; k < m; k++)
+                checksum += BandpassFilter_Apply(&filter, chunk_out[k] * 2);
+        }
+    }
+    double pipeline_ns = (double)(bench_now() - t0) / BENCH_REPEAT;
+
+    double diff = 0;
+    double power = 0;
+    double mean = 0;
+    double max_diff = 0;
+    for (size_t i = BENCH_EDGE; i + BENCH_EDGE < num; i++)
+        mean += reference[i];
+    mean /= (double)(num - 2 * BENCH_EDGE);
+    for (size_t i = BENCH_EDGE; i + BENCH_EDGE < num; i++)
+    {
+        double d = streamed[i] - reference[i];
+        diff += d * d;
+        power += (reference[i] - mean) * (reference[i] - mean);
+        if (fabs(d) > max_diff)
+            max_diff = fabs(d);
+    }
+
+    /* What the detector sees: both outputs through the firmware filter */
+    double band_diff = 0;
+    double band_power = 0;
+    BandpassFilter filter_ref;
+    BandpassFilter_Init(&filter);
+    BandpassFilter_Init(&filter_ref);
+    for (size_t i = 0; i + BENCH_EDGE < num; i++)
+    {
+        int32_t a = BandpassFilter_Apply(&filter, streamed[i] * 2);
+        int32_t b = BandpassFilter_Apply(&filter_ref, (int32_t)lrint(reference[i]) * 2);
+        if (i >= BENCH_EDGE)
+        {
+            band_diff += (double)(a - b) * (a - b);
+            band_power += (double)b * b;
+        }
+    }
+
+    size_t state_bytes = sizeof(Resampler) + (size_t)rs.up * rs.taps * sizeof(float) + 2 * rs.taps * sizeof(float);
+
+    printf("{\n  \"benchmark\": \"resample\",\n  \"input_samples\": %zu,\n  \"output_samples\": %zu,\n", n, num);
+    printf("  \"up\": %u,\n  \"down\": %u,\n  \"taps_per_phase\": %u,\n  \"latency_input_samples\": %u,\n",
+           rs.up, rs.down, rs.taps, rs.latency);
+    printf("  \"chunk_mismatches\": %zu,\n", mismatches);
+    printf("  \"vs_fft\": {\"snr_db\": %.1f, \"max_abs_diff\": %.2f, \"after_bandpass_snr_db\": %.1f},\n",
+           10.0 * log10(power / diff), max_diff, 10.0 * log10(band_power / band_diff));
+    printf("  \"fft_resample\": {\"ms\": %.1f, \"working_bytes\": %zu},\n", fft_ns / 1e6, fft_bytes);
+    printf("  \"polyphase_stream\": {\"ms\": %.2f, \"msamples_per_s\": %.1f, \"state_bytes\": %zu},\n",
+           stream_ns / 1e6, n * 1e3 / stream_ns, state_bytes);
+    printf("  \"stream_plus_bandpass\": {\"ms\": %.2f, \"msamples_per_s\": %.1f, \"checksum\": %lld}\n}\n",
+           pipeline_ns / 1e6, n * 1e3 / pipeline_ns, (long long)(checksum / BENCH_REPEAT));
+
+    Resampler_Free(&rs);
+    free(x);
+    free(reference);
+    free(streamed);
+    free(oneshot);
+    return mismatches ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void bench_fft(double complex *a, size_t size, int inverse)
+{
+    for (size_t i = 1, j = 0; i < size; i++)
+    {
+        size_t bit = size >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+        {
+            double complex t = a[i];
+            a[i] = a[j];
+            a[j] = t;
+        }
+    }
+    for (size_t len = 2; len <= size; len <<= 1)
+    {
+        double angle = (inverse ? 2.0 : -2.0) * M_PI / (double)len;
+        for (size_t i = 0; i < size; i += len)
+        {
+            for (size_t k = 0; k < len / 2; k++)
+            {
+                double complex w = cexp(I * angle * (double)k);
+                double complex u = a[i + k];
+                double complex v = a[i + k + len / 2] * w;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+            }
+        }
+    }
+}
+
+static size_t bench_dft(const double complex *in, double complex *out, size_t n, int inverse)
+{
+    size_t size = 1;
+    while (size < 2 * n - 1)
+        size <<= 1;
+    double complex *chirp = malloc(n * sizeof(double complex));
+    double complex *a = calloc(size, sizeof(double complex));
+    double complex *b = calloc(size, sizeof(double complex));
+    const double sign = inverse ? 1.0 : -1.0;
+
+    /* jk = (j^2 + k^2 - (k - j)^2) / 2, j^2 taken mod 2n to keep the angle exact */
+    for (size_t j = 0; j < n; j++)
+        chirp[j] = cexp(I * sign * M_PI * (double)(((uint64_t)j * j) % (2 * n)) / (double)n);
+    for (size_t j = 0; j < n; j++)
+        a[j] = in[j] * chirp[j];
+    b[0] = conj(chirp[0]);
+    for (size_t j = 1; j < n; j++)
+        b[j] = b[size - j] = conj(chirp[j]);
+
+    bench_fft(a, size, 0);
+    bench_fft(b, size, 0);
+    for (size_t i = 0; i < size; i++)
+        a[i] *= b[i];
+    bench_fft(a, size, 1);
+    for (size_t k = 0; k < n; k++)
+        out[k] = a[k] / (double)size * chirp[k];
+
+    free(chirp);
+    free(a);
+    free(b);
+    return (n + 2 * size) * sizeof(double complex);
+}
+
+static size_t bench_fft_resample(const int32_t *x, size_t n, double *y, size_t num)
+{
+    double complex *spectrum = malloc(n * sizeof(double complex));
+    double complex *resampled = malloc(num * sizeof(double complex));
+    for (size_t i = 0; i < n; i++)
+        spectrum[i] = x[i];
+    size_t bytes = bench_dft(spectrum, spectrum, n, 0);
+
+    /* Keep bins 0..num/2 and their mirror images, num is odd */
+    memset(resampled, 0, num * sizeof(double complex));
+    for (size_t k = 0; k <= num / 2; k++)
+    {
+        resampled[k] = spectrum[k];
+        if (k > 0)
+            resampled[num - k] = conj(spectrum[k]);
+    }
+    size_t inverse_bytes = bench_dft(resampled, resampled, num, 1);
+    for (size_t i = 0; i < num; i++)
+        y[i] = creal(resampled[i]) / (double)n;
+
+    free(spectrum);
+    free(resampled);
+    bytes = (bytes > inverse_bytes) ? bytes : inverse_bytes;
+    return bytes + (n + num) * sizeof(double complex);
+}
+
+static size_t bench_stream(Resampler *rs, const int32_t *x, size_t n, int32_t *y, size_t chunk)
+{
+    size_t produced = 0;
+    Resampler_Reset(rs);
+    for (size_t i = 0; i < n; i += chunk)
+    {
+        size_t len = (n - i < chunk) ? n - i : chunk;
+        produced += Resampler_Process(rs, x + i, y + produced, len);
+    }
+    produced += Resampler_Flush(rs, y + produced);
+    return produced;
+}
+
+/* End of file -------------------------------------------------------- */
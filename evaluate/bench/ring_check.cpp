@@ -0,0 +1,205 @@
+/**
+ * @file       ring_check.cpp
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Host checks for Ring<T, N> in ring.hpp.
+ *
+ * @note       Build and run from the repository root:
+ *             g++ -std=c++17 -O2 -pthread -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/ring_check.cpp -o ring_check
+ *             ./ring_check
+ *             Add -DRING_HAS_ATOMIC=0 to build the volatile/barrier indices
+ *             used when <atomic> is not available.
+ *             Instantiates Ring<adc_sample_t, ADC_SAMPLE_RING_SIZE> and a
+ *             small Ring<uint32_t, 8>. Single-thread part: capacity, writes
+ *             and reads across the array end, peek segments, and consume
+ *             clamped to count(). Thread part: a producer and a consumer
+ *             thread move a counting sequence through the small ring and
+ *             every record must arrive once and in order. Exit status is 0
+ *             when every check passes.
+ * @example    ring_check.cpp
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "ring.hpp"
+#include <cstdio>
+#include <thread>
+
+extern "C" {
+#include "adc_sample.h"
+}
+
+/* Private definitions ----------------------------------------------- */
+namespace
+{
+constexpr uint32_t kSequence = 20000000; /**< Records in the thread check */
+
+uint32_t failures = 0;
+
+/**
+ * @brief  Count a failed condition and report where it happened.
+ */
+#define CHECK(cond)                                                                 \
+    do                                                                              \
+    {                                                                               \
+        if (!(cond))                                                                \
+        {                                                                           \
+            failures++;                                                             \
+            if (failures <= 10)                                                     \
+                fprintf(stderr, "%s:%d: %s failed\n", __func__, __LINE__, #cond);  \
+        }                                                                           \
+    } while (0)
+
+/**
+ * @brief  Capacity, wrap, peek and consume clamp on a small ring.
+ */
+void check_single()
+{
+    static Ring<uint32_t, 8> ring;
+    uint32_t io[16];
+    const uint32_t *ptr = nullptr;
+
+    for (uint32_t i = 0; i < 16; i++)
+        io[i] = 100 + i;
+
+    /* Full ring holds N records, not N - 1 */
+    CHECK(ring.count() == 0 && ring.space() == 8);
+    CHECK(ring.write(io, 16) == 8);
+    CHECK(ring.count() == 8 && ring.space() == 0);
+    CHECK(ring.write(io, 1) == 0);
+
+    /* Move the reader to 6, then write across the array end */
+    uint32_t out[16] = {};
+    CHECK(ring.read(out, 6) == 6 && out[0] == 100 && out[5] == 105);
+    CHECK(ring.write(io + 8, 6) == 6);
+    CHECK(ring.count() == 8);
+
+    /* Peek gives slots 6..7 first, then 0..5 */
+    CHECK(ring.peek(&ptr) == 2 && ptr == ring.data() + 6 && ptr[0] == 106 && ptr[1] == 107);
+    CHECK(ring.consume(2) == 2);
+    CHECK(ring.peek(&ptr) == 6 && ptr == ring.data() && ptr[0] == 108 && ptr[5] == 113);
+
+    /* Consuming more than is stored stops at count() */
+    CHECK(ring.consume(3) == 3);
+    CHECK(ring.consume(100) == 3);
+    CHECK(ring.count() == 0 && ring.space() == 8);
+    CHECK(ring.consume(1) == 0);
+    CHECK(ring.write(io, 8) == 8);
+
+    /* Read across the end in one call */
+    CHECK(ring.read(out, 16) == 8);
+    for (uint32_t i = 0; i < 8; i++)
+        CHECK(out[i] == 100 + i);
+
+    ring.clear();
+    CHECK(ring.count() == 0 && ring.peek(&ptr) == 0);
+    printf("single: done\n");
+}
+
+/**
+ * @brief  The record ring the firmware layout matches.
+ */
+void check_adc_ring()
+{
+    static Ring<adc_sample_t, ADC_SAMPLE_RING_SIZE> ring;
+    adc_sample_t block[100];
+    adc_sample_t out[100];
+    uint32_t next = 0;
+    uint32_t expected = 0;
+
+    static_assert(sizeof(ring.data()[0]) == 4, "record layout changed");
+
+    /* Rounds of 100 in, 100 out sweep the index past the array end */
+    for (int round = 0; round < 50; round++)
+    {
+        for (uint32_t i = 0; i < 100; i++, next++)
+        {
+            block[i].raw = (uint16_t)(next & 0x0FFF);
+            block[i].filtered = (int16_t)(next * 3);
+        }
+        CHECK(ring.write(block, 100) == 100);
+        CHECK(ring.read(out, 100) == 100);
+        for (uint32_t i = 0; i < 100; i++, expected++)
+            CHECK(out[i].raw == (uint16_t)(expected & 0x0FFF) && out[i].filtered == (int16_t)(expected * 3));
+    }
+
+    printf("adc_ring: %u records\n", next);
+}
+
+/**
+ * @brief  Producer and consumer threads on a small ring.
+ */
+void check_threads()
+{
+    static Ring<uint32_t, 64> ring;
+    uint32_t mismatches = 0;
+    uint32_t received = 0;
+
+    std::thread producer([] {
+        uint32_t block[16];
+        uint32_t next = 0;
+        while (next < kSequence)
+        {
+            uint32_t n = 1 + (next % 16);
+            if (n > kSequence - next)
+                n = kSequence - next;
+            for (uint32_t i = 0; i < n; i++)
+                block[i] = next + i;
+            uint32_t done = 0;
+            while (done < n)
+            {
+                uint32_t written = ring.write(block + done, n - done);
+                if (written == 0)
+                    std::this_thread::yield();
+                done += written;
+            }
+            next += n;
+        }
+    });
+
+    /* Mix copying reads with peek/consume so both paths see the producer */
+    uint32_t block[16];
+    while (received < kSequence)
+    {
+        if (received & 1)
+        {
+            const uint32_t *ptr = nullptr;
+            uint32_t n = ring.peek(&ptr);
+            for (uint32_t i = 0; i < n; i++)
+                mismatches += ptr[i] != received + i;
+            received += ring.consume(n);
+        }
+        else
+        {
+            uint32_t n = ring.read(block, 16);
+            for (uint32_t i = 0; i < n; i++)
+                mismatches += block[i] != received + i;
+            received += n;
+        }
+        if (ring.count() == 0)
+            std::this_thread::yield();
+    }
+
+    producer.join();
+    CHECK(mismatches == 0);
+    CHECK(ring.count() == 0);
+    printf("threads: %u records, %u mismatches\n", received, mismatches);
+}
+} // namespace
+
+/* Function definitions ----------------------------------------------- */
+int main()
+{
+    check_single();
+    check_adc_ring();
+    check_threads();
+
+    printf("%u failures\n", failures);
+    return failures ? 1 : 0;
+}
+
+/* End of file -------------------------------------------------------- */
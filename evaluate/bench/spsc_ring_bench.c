@@ -0,0 +1,285 @@
+/**
+ * @file       spsc_ring_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Cross-core throughput and sequence check for spsc_ring.
+ *
+ * @note       Build and run on x86-64 Linux from the repository root:
+ *             gcc -O2 -pthread -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/spsc_ring_bench.c
+ *                 Embedded/QRS_ECG/Core/Src/spsc_ring.c -o spsc_ring_bench
+ *             ./spsc_ring_bench [--quick] [--cores A,B] > result.json
+ *             The producer writes a 64-bit counting sequence and the
+ *             consumer checks every item against the next expected value,
+ *             BENCH_ITEMS items per case. Producer and consumer are pinned
+ *             to cores A and B, by default the first two cores of the
+ *             process affinity mask; "pinned" is false in the JSON when
+ *             fewer than two cores are available and the threads share one.
+ *             Exit status is 1 when any item is missing, duplicated or out
+ *             of order.
+ * @example    spsc_ring_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#define _GNU_SOURCE
+#include "spsc_ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_ITEMS     (64u << 20) /*!< Items moved per case */
+#define BENCH_MAX_BATCH (1024u)     /*!< Largest batch used by any case */
+
+/* Private enumerate/structure ---------------------------------------- */
+/**
+ * @brief Producer/consumer thread context.
+ */
+typedef struct
+{
+    spsc_ring_t *ring;    /**< Shared ring */
+    uint32_t batch;       /**< Items per call */
+    uint64_t total;       /**< Items to move */
+    int core;             /**< Core to pin to, -1 for none */
+    uint64_t calls;       /**< Calls that moved data */
+    uint64_t mismatches;  /**< Items that broke the sequence (consumer) */
+} bench_side_t;
+
+/* Private variables -------------------------------------------------- */
+static const uint32_t ring_counts[] = {64, 1024, 16384};
+static const uint32_t batch_sizes[] = {1, 16, 256, 1024};
+static int first_result = 1;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Monotonic time in nanoseconds.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current time in ns
+ */
+static uint64_t bench_now(void);
+
+/**
+ * @brief  Pin the calling thread to one core.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - (0) : Pinned
+ *  - (-1): Not pinned
+ */
+static int bench_pin(int core);
+
+/**
+ * @brief  Run one producer/consumer case and print its JSON entry.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of sequence errors
+ */
+static uint64_t bench_case(uint32_t count, uint32_t batch, uint64_t total, const int cores[2]);
+
+/**
+ * @brief  Producer thread: write the sequence 0, 1, 2, ...
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - NULL
+ */
+static void *bench_producer(void *arg);
+
+/**
+ * @brief  Consumer thread: read and check the sequence.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - NULL
+ */
+static void *bench_consumer(void *arg);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    int cores[2] = {-1, -1};
+    uint64_t total = BENCH_ITEMS;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--quick") == 0)
+            total /= 16;
+        else if (strcmp(argv[i], "--cores") == 0 && i + 1 < argc &&
+                 sscanf(argv[++i], "%d,%d", &cores[0], &cores[1]) != 2)
+        {
+            fprintf(stderr, "--cores expects A,B\n");
+            return 2;
+        }
+    }
+
+    /* Default: the first two cores this process may run on */
+    if (cores[0] < 0)
+    {
+        cpu_set_t set;
+        int found = 0;
+        CPU_ZERO(&set);
+        sched_getaffinity(0, sizeof(set), &set);
+        for (int c = 0; c < CPU_SETSIZE && found < 2; c++)
+            if (CPU_ISSET(c, &set))
+                cores[found++] = c;
+        if (found < 2)
+            cores[0] = cores[1] = -1;
+    }
+
+    printf("{\n  \"benchmark\": \"spsc_ring\",\n  \"item_bytes\": %zu,\n", sizeof(uint64_t));
+    printf("  \"producer_core\": %d,\n  \"consumer_core\": %d,\n", cores[0], cores[1]);
+    printf("  \"results\": [\n");
+
+    uint64_t errors = 0;
+    for (size_t r = 0; r < sizeof(ring_counts) / sizeof(ring_counts[0]); r++)
+        for (size_t b = 0; b < sizeof(batch_sizes) / sizeof(batch_sizes[0]); b++)
+            if (batch_sizes[b] <= ring_counts[r])
+                errors += bench_case(ring_counts[r], batch_sizes[b], total, cores);
+
+    printf("\n  ],\n  \"sequence_errors\": %llu\n}\n", (unsigned long long)errors);
+    return errors ? 1 : 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int bench_pin(int core)
+{
+    cpu_set_t set;
+    if (core < 0)
+        return -1;
+
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+}
+
+static uint64_t bench_case(uint32_t count, uint32_t batch, uint64_t total, const int cores[2])
+{
+    spsc_ring_t *ring = aligned_alloc(SPSC_CACHE_LINE, sizeof(spsc_ring_t));
+    uint64_t *storage = malloc((size_t)count * sizeof(uint64_t));
+    pthread_t producer;
+    pthread_t consumer;
+    bench_side_t prod = {ring, batch, total, cores[0], 0, 0};
+    bench_side_t cons = {ring, batch, total, cores[1], 0, 0};
+    uint64_t t0 = 0;
+    uint64_t elapsed = 0;
+
+    if (ring == NULL || storage == NULL || spsc_init(ring, storage, count, sizeof(uint64_t)) != SPSC_SUCCESS)
+    {
+        free(ring);
+        free(storage);
+        return 1;
+    }
+
+    t0 = bench_now();
+    pthread_create(&consumer, NULL, bench_consumer, &cons);
+    pthread_create(&producer, NULL, bench_producer, &prod);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    elapsed = bench_now() - t0;
+
+    /* bench_pin clears core on failure */
+    int pinned = prod.core >= 0 && cons.core >= 0;
+    printf("%s    {\"ring_items\": %u, \"batch\": %u, \"items\": %llu, \"pinned\": %s, "
+           "\"items_per_s\": %.0f, \"bytes_per_s\": %.0f, \"ns_per_write\": %.2f, \"ns_per_read\": %.2f, "
+           "\"mismatches\": %llu}",
+           first_result ? "" : ",\n", count, batch, (unsigned long long)total, pinned ? "true" : "false",
+           (double)total * 1e9 / elapsed, (double)total * sizeof(uint64_t) * 1e9 / elapsed,
+           (double)elapsed / prod.calls, (double)elapsed / cons.calls, (unsigned long long)cons.mismatches);
+    first_result = 0;
+    fflush(stdout);
+
+    free(ring);
+    free(storage);
+    return cons.mismatches;
+}
+
+static void *bench_producer(void *arg)
+{
+    bench_side_t *side = arg;
+    uint64_t block[BENCH_MAX_BATCH];
+    uint64_t next = 0;
+
+    if (bench_pin(side->core) != 0)
+        side->core = -1;
+
+    while (next < side->total)
+    {
+        uint32_t n = side->batch;
+        if (n > side->total - next)
+            n = (uint32_t)(side->total - next);
+        for (uint32_t i = 0; i < n; i++)
+            block[i] = next + i;
+
+        uint32_t done = 0;
+        while (done < n)
+        {
+            uint32_t written = spsc_write(side->ring, block + done, n - done);
+            if (written == 0)
+            {
+                sched_yield();
+                continue;
+            }
+            done += written;
+            side->calls++;
+        }
+        next += n;
+    }
+
+    return NULL;
+}
+
+static void *bench_consumer(void *arg)
+{
+    bench_side_t *side = arg;
+    uint64_t block[BENCH_MAX_BATCH];
+    uint64_t expected = 0;
+
+    if (bench_pin(side->core) != 0)
+        side->core = -1;
+
+    while (expected < side->total)
+    {
+        uint32_t n = spsc_read(side->ring, block, side->batch);
+        if (n == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        side->calls++;
+
+        /* Resync after a mismatch so one bad item is counted once */
+        for (uint32_t i = 0; i < n; i++, expected++)
+        {
+            if (block[i] != expected)
+            {
+                side->mismatches++;
+                expected = block[i];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* End of file -------------------------------------------------------- */
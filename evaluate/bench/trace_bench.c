@@ -0,0 +1,206 @@
+/**
+ * @file       trace_bench.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Hot-path cost of trace_log against the sprintf debug line it
+ *             replaces, and a capture of the detector's trace for the decoder.
+ *
+ * @note       Build and run from the repository root:
+ *             gcc -O2 -I evaluate/bench/host -I Embedded/QRS_ECG/Core/Inc
+ *                 evaluate/bench/trace_bench.c evaluate/bench/mitbih.c
+ *                 evaluate/bench/host/hal_stub.c
+ *                 Embedded/QRS_ECG/Core/Src/filter.c
+ *                 Embedded/QRS_ECG/Core/Src/qrs_detector.c
+ *                 Embedded/QRS_ECG/Core/Src/trace.c
+ *                 Embedded/QRS_ECG/Core/Src/cbuffer.c -o trace_bench
+ *             ./trace_bench [evaluate/data/100.dat] [--capture trace.bin]
+ *             python3 evaluate/src/trace_decode.py trace.bin
+ *             Costs are TSC cycles per call on x86, ns elsewhere. The UART
+ *             time of the old path is computed for 38400 baud, 8N1; the HAL
+ *             stand-in returns at once.
+ * @example    trace_bench.c
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include "mitbih.h"
+#include "mylib.h"
+#include "qrs_detector.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Private defines ---------------------------------------------------- */
+#define BENCH_ROUNDS  (20000) /*!< Timed batches per case */
+#define BENCH_BATCH   (16)    /*!< Calls per timed batch, half of trace_irq */
+#define BENCH_WINDOW  (2000)  /*!< Detector block, 10 s at 200 Hz */
+#define BENCH_BAUD    (38400) /*!< Firmware UART rate */
+
+/* Private variables -------------------------------------------------- */
+static double samples[BENCH_ROUNDS];
+static volatile int32_t sink;
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Cycle counter, or ns where no cycle counter is available.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Current count
+ */
+static uint64_t bench_cycles(void);
+
+/**
+ * @brief  qsort comparator for doubles.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - <0, 0, >0
+ */
+static int bench_compare(const void *a, const void *b);
+
+/**
+ * @brief  Print median, p99 and max of the per-call costs in samples.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void bench_emit(const char *name, int last);
+
+/* Function definitions ----------------------------------------------- */
+int main(int argc, char **argv)
+{
+    const char *path = "evaluate/data/100.dat";
+    const char *capture = NULL;
+    char msg[50];
+    size_t n = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+            capture = argv[++i];
+        else
+            path = argv[i];
+    }
+
+    int32_t *record = mitbih_load(path, 2, 0, &n);
+    if (record == NULL || n < BENCH_WINDOW)
+    {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    trace_init(&trace_irq, trace_irq_data, TRACE_IRQ_RECORDS);
+    trace_init(&trace_app, trace_app_data, TRACE_APP_RECORDS);
+
+    printf("{\n  \"benchmark\": \"trace\",\n");
+#if defined(__x86_64__) || defined(__i386__)
+    printf("  \"unit\": \"tsc_cycles_per_call\",\n");
+#else
+    printf("  \"unit\": \"ns_per_call\",\n");
+#endif
+    printf("  \"results\": [\n");
+
+    /* New hot path: one record into the ring, drained outside the timing */
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+    {
+        uint64_t t0 = bench_cycles();
+        for (int i = 0; i < BENCH_BATCH; i++)
+            trace_log(&trace_irq, TRACE_EV_FILTER, 0, record[(r * BENCH_BATCH + i) % n], 0);
+        samples[r] = (double)(bench_cycles() - t0) / BENCH_BATCH;
+        trace_drain(&trace_irq, &huart2, BENCH_BATCH);
+    }
+    bench_emit("trace_log", 0);
+
+    /* Old hot path without the UART wait: format the line, hand it to the HAL */
+    for (int r = 0; r < BENCH_ROUNDS; r++)
+    {
+        uint64_t t0 = bench_cycles();
+        for (int i = 0; i < BENCH_BATCH; i++)
+        {
+            sprintf(msg, "DEBUG:FILTER:%ld\n", (long)record[(r * BENCH_BATCH + i) % n]);
+            HAL_UART_Transmit(&huart2, (uint8_t*)msg, strlen(msg), 200);
+        }
+        samples[r] = (double)(bench_cycles() - t0) / BENCH_BATCH;
+    }
+    bench_emit("sprintf_line", 1);
+
+    /* A typical line is ~18 bytes, 10 bits each on the wire */
+    sprintf(msg, "DEBUG:FILTER:%ld\n", -1234L);
+    printf("  ],\n  \"old_line_bytes\": %zu,\n  \"old_line_uart_us\": %.0f,\n", strlen(msg),
+           strlen(msg) * 10 * 1e6 / BENCH_BAUD);
+    printf("  \"sample_period_us\": 5000,\n  \"packet_bytes\": %d,\n", TRACE_PACKET_SIZE);
+
+    /* Detector trace on the first 10 s of the filtered record */
+    int32_t *filtered = malloc(BENCH_WINDOW * sizeof(int32_t));
+    uint8_t *flags = malloc(BENCH_WINDOW);
+    BandpassFilter filter;
+    QRSDetector detector;
+    FILE *out = (capture != NULL) ? fopen(capture, "wb") : NULL;
+    uint32_t records = 0;
+    uint32_t sent = 0;
+
+    BandpassFilter_Init(&filter);
+    for (size_t i = 0; i < BENCH_WINDOW; i++)
+        filtered[i] = BandpassFilter_Apply(&filter, record[i] * 2);
+    QRSDetector_Detect(&detector, filtered, flags);
+
+    huart2.capture = out;
+    do
+    {
+        sent = trace_drain(&trace_irq, &huart2, 8) + trace_drain(&trace_app, &huart2, 8);
+        records += sent;
+    } while (sent > 0);
+    huart2.capture = NULL;
+    if (out != NULL)
+        fclose(out);
+
+    printf("  \"detector_peaks\": %u,\n  \"drained_records\": %u\n}\n", detector.peak_count, records);
+
+    free(filtered);
+    free(flags);
+    free(record);
+    return 0;
+}
+
+/* Private definitions ----------------------------------------------- */
+static uint64_t bench_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static int bench_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_emit(const char *name, int last)
+{
+    qsort(samples, BENCH_ROUNDS, sizeof(samples[0]), bench_compare);
+    printf("    {\"case\": \"%s\", \"median\": %.1f, \"p99\": %.1f, \"max\": %.1f}%s\n", name,
+           samples[BENCH_ROUNDS / 2], samples[BENCH_ROUNDS * 99 / 100], samples[BENCH_ROUNDS - 1],
+           last ? "" : ",");
+    sink += (int32_t)samples[0];
+}
+
+/* End of file -------------------------------------------------------- */
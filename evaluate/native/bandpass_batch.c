@@ -0,0 +1,194 @@
+/**
+ * @file       bandpass_batch.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Scalar and AVX2 kernels of the batch Bandpass Filter.
+ *
+ * @note       The AVX2 kernel is compiled with a target attribute, so the
+ *             file builds with plain -O2 and still runs on CPUs without
+ *             AVX2. Per time step each lane does exactly what
+ *             BandpassFilter_Apply does: two running sums, the low-pass
+ *             scale and shift, the high-pass shift and a clamp to int16,
+ *             with window sizes and constants taken from filter.h.
+ * @example    bandpass_batch.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "bandpass_batch.h"
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BANDPASS_BATCH_HAVE_AVX2 1
+#else
+#define BANDPASS_BATCH_HAVE_AVX2 0
+#endif
+
+/* Private defines ---------------------------------------------------- */
+#define BANDPASS_BATCH_CHUNK (256) /*!< Time steps per transpose in FilterChannels */
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Scalar kernel, the reference for the AVX2 one.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - None
+ */
+static void BandpassBatch_RunScalar(BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n);
+
+#if BANDPASS_BATCH_HAVE_AVX2
+/**
+ * @brief  AVX2 kernel, one 8-lane register per time step.
+ *
+ * @attention  Internal function, not for direct use. Only call after
+ *             checking the CPU supports AVX2.
+ *
+ * @return
+ *  - None
+ */
+__attribute__((target("avx2")))
+static void BandpassBatch_RunAvx2(BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n);
+#endif
+
+/* Function definitions ----------------------------------------------- */
+int BandpassBatch_Init(BandpassBatch* batch, BandpassBatchKernel kernel)
+{
+    BandpassBatch_Reset(batch);
+    batch->run = BandpassBatch_RunScalar;
+
+#if BANDPASS_BATCH_HAVE_AVX2
+    if (kernel != BANDPASS_BATCH_SCALAR && __builtin_cpu_supports("avx2")) {
+        batch->run = BandpassBatch_RunAvx2;
+        return 1;
+    }
+#else
+    (void)kernel;
+#endif
+
+    return 0;
+}
+
+void BandpassBatch_Reset(BandpassBatch* batch)
+{
+    memset(batch->lowpass_buffer, 0, sizeof(batch->lowpass_buffer));
+    memset(batch->highpass_buffer, 0, sizeof(batch->highpass_buffer));
+    memset(batch->lowpass_sum, 0, sizeof(batch->lowpass_sum));
+    memset(batch->highpass_sum, 0, sizeof(batch->highpass_sum));
+    batch->lowpass_index = 0;
+    batch->highpass_index = 0;
+}
+
+void BandpassBatch_Run(BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n)
+{
+    batch->run(batch, in, out, n);
+}
+
+void BandpassBatch_FilterChannels(BandpassBatch* batch, const int32_t* const* in, int32_t* const* out,
+                                  size_t channels, size_t n)
+{
+    int32_t block[BANDPASS_BATCH_CHUNK][BANDPASS_BATCH_LANES];
+
+    for (size_t c0 = 0; c0 < channels; c0 += BANDPASS_BATCH_LANES) {
+        size_t lanes = channels - c0;
+        if (lanes > BANDPASS_BATCH_LANES) lanes = BANDPASS_BATCH_LANES;
+
+        BandpassBatch_Reset(batch);
+        memset(block, 0, sizeof(block));
+        for (size_t t0 = 0; t0 < n; t0 += BANDPASS_BATCH_CHUNK) {
+            size_t steps = n - t0;
+            if (steps > BANDPASS_BATCH_CHUNK) steps = BANDPASS_BATCH_CHUNK;
+
+            // Transpose planar channels into lanes, unused lanes stay zero
+            for (size_t lane = 0; lane < lanes; lane++) {
+                const int32_t* src = in[c0 + lane] + t0;
+                for (size_t t = 0; t < steps; t++) {
+                    block[t][lane] = src[t];
+                }
+            }
+
+            batch->run(batch, &block[0][0], &block[0][0], steps);
+
+            for (size_t lane = 0; lane < lanes; lane++) {
+                int32_t* dst = out[c0 + lane] + t0;
+                for (size_t t = 0; t < steps; t++) {
+                    dst[t] = block[t][lane];
+                }
+            }
+        }
+    }
+}
+
+/* Private definitions ----------------------------------------------- */
+static void BandpassBatch_RunScalar(BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n)
+{
+    uint32_t li = batch->lowpass_index;
+    uint32_t hi = batch->highpass_index;
+
+    for (size_t t = 0; t < n; t++) {
+        for (size_t lane = 0; lane < BANDPASS_BATCH_LANES; lane++) {
+            int32_t x = in[t * BANDPASS_BATCH_LANES + lane];
+            batch->lowpass_sum[lane] += x - batch->lowpass_buffer[li][lane];
+            batch->lowpass_buffer[li][lane] = x;
+
+            int32_t lowpass = (batch->lowpass_sum[lane] * BANDPASS_LOWPASS_SCALE) >> BANDPASS_LOWPASS_SHIFT;
+            batch->highpass_sum[lane] += lowpass - batch->highpass_buffer[hi][lane];
+            batch->highpass_buffer[hi][lane] = lowpass;
+
+            int32_t highpass = lowpass - (batch->highpass_sum[lane] >> BANDPASS_HIGHPASS_SHIFT);
+            if (highpass > 32767) highpass = 32767;
+            if (highpass < -32768) highpass = -32768;
+            out[t * BANDPASS_BATCH_LANES + lane] = highpass;
+        }
+
+        if (++li == BANDPASS_BATCH_LOWPASS_SIZE) li = 0;
+        hi = (hi + 1) & (BANDPASS_BATCH_HIGHPASS_SIZE - 1);
+    }
+
+    batch->lowpass_index = li;
+    batch->highpass_index = hi;
+}
+
+#if BANDPASS_BATCH_HAVE_AVX2
+__attribute__((target("avx2")))
+static void BandpassBatch_RunAvx2(BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n)
+{
+    const __m256i scale = _mm256_set1_epi32(BANDPASS_LOWPASS_SCALE);
+    const __m256i max16 = _mm256_set1_epi32(32767);
+    const __m256i min16 = _mm256_set1_epi32(-32768);
+    __m256i lowpass_sum = _mm256_loadu_si256((const __m256i*)batch->lowpass_sum);
+    __m256i highpass_sum = _mm256_loadu_si256((const __m256i*)batch->highpass_sum);
+    uint32_t li = batch->lowpass_index;
+    uint32_t hi = batch->highpass_index;
+
+    for (size_t t = 0; t < n; t++) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)&in[t * BANDPASS_BATCH_LANES]);
+        __m256i* lp_slot = (__m256i*)batch->lowpass_buffer[li];
+        lowpass_sum = _mm256_add_epi32(lowpass_sum, _mm256_sub_epi32(x, _mm256_loadu_si256(lp_slot)));
+        _mm256_storeu_si256(lp_slot, x);
+
+        __m256i lowpass = _mm256_srai_epi32(_mm256_mullo_epi32(lowpass_sum, scale), BANDPASS_LOWPASS_SHIFT);
+        __m256i* hp_slot = (__m256i*)batch->highpass_buffer[hi];
+        highpass_sum = _mm256_add_epi32(highpass_sum, _mm256_sub_epi32(lowpass, _mm256_loadu_si256(hp_slot)));
+        _mm256_storeu_si256(hp_slot, lowpass);
+
+        __m256i highpass = _mm256_sub_epi32(lowpass, _mm256_srai_epi32(highpass_sum, BANDPASS_HIGHPASS_SHIFT));
+        highpass = _mm256_max_epi32(_mm256_min_epi32(highpass, max16), min16);
+        _mm256_storeu_si256((__m256i*)&out[t * BANDPASS_BATCH_LANES], highpass);
+
+        if (++li == BANDPASS_BATCH_LOWPASS_SIZE) li = 0;
+        hi = (hi + 1) & (BANDPASS_BATCH_HIGHPASS_SIZE - 1);
+    }
+
+    _mm256_storeu_si256((__m256i*)batch->lowpass_sum, lowpass_sum);
+    _mm256_storeu_si256((__m256i*)batch->highpass_sum, highpass_sum);
+    batch->lowpass_index = li;
+    batch->highpass_index = hi;
+}
+#endif
+
+/* End of file -------------------------------------------------------- */
@@ -0,0 +1,123 @@
+/**
+ * @file       bandpass_batch.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Batch version of the firmware Bandpass Filter for offline
+ *             re-processing on x86-64 servers.
+ *
+ * @note       Runs the filter from Core/Src/filter.c on 8 independent
+ *             channels at once, one int32 lane per channel. The AVX2 kernel
+ *             is picked at runtime when the CPU supports it, otherwise a
+ *             scalar kernel with the same arithmetic runs. Both are
+ *             bit-exact with BandpassFilter_Apply.
+ * @example    bandpass_batch_bench.c
+ *             BandpassBatch batch;
+ *             BandpassBatch_Init(&batch, BANDPASS_BATCH_AUTO);
+ *             BandpassBatch_FilterChannels(&batch, in, out, 12, n);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef BANDPASS_BATCH_H_
+#define BANDPASS_BATCH_H_
+
+/* Includes ----------------------------------------------------------- */
+#include "filter.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define BANDPASS_BATCH_LANES          (8)  /*!< Channels per batch, one AVX2 register */
+#define BANDPASS_BATCH_LOWPASS_SIZE   BANDPASS_LOWPASS_WINDOW_SIZE  /*!< Low-pass window of filter.h */
+#define BANDPASS_BATCH_HIGHPASS_SIZE  BANDPASS_HIGHPASS_WINDOW_SIZE /*!< High-pass window of filter.h */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Kernel selection.
+ */
+typedef enum
+{
+    BANDPASS_BATCH_AUTO = 0, /**< AVX2 when the CPU has it, scalar otherwise */
+    BANDPASS_BATCH_SCALAR,   /**< Always the scalar reference */
+    BANDPASS_BATCH_AVX2      /**< AVX2, falls back to scalar if unsupported */
+} BandpassBatchKernel;
+
+/**
+ * @brief Filter state for 8 channels, lane-interleaved.
+ */
+typedef struct BandpassBatch
+{
+    int32_t lowpass_buffer[BANDPASS_BATCH_LOWPASS_SIZE][BANDPASS_BATCH_LANES];   /*!< Low-pass window */
+    int32_t highpass_buffer[BANDPASS_BATCH_HIGHPASS_SIZE][BANDPASS_BATCH_LANES]; /*!< High-pass window */
+    int32_t lowpass_sum[BANDPASS_BATCH_LANES];                                   /*!< Running sums */
+    int32_t highpass_sum[BANDPASS_BATCH_LANES];                                  /*!< Running sums */
+    uint32_t lowpass_index;                                                      /*!< Oldest low-pass entry */
+    uint32_t highpass_index;                                                     /*!< Oldest high-pass entry */
+    void (*run)(struct BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n); /*!< Selected kernel */
+} BandpassBatch;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Initialize the batch filter and select the kernel.
+ *
+ * @param[inout]  batch   Pointer to the BandpassBatch structure.
+ * @param[in]     kernel  Requested kernel.
+ *
+ * @attention  Must be called before using the filter.
+ *
+ * @return
+ *  - 1: AVX2 kernel selected
+ *  - 0: Scalar kernel selected
+ */
+int BandpassBatch_Init(BandpassBatch* batch, BandpassBatchKernel kernel);
+
+/**
+ * @brief  Clear the filter state, keep the kernel.
+ *
+ * @param[inout]  batch  Pointer to the BandpassBatch structure.
+ *
+ * @attention  None
+ *
+ * @return
+ *  - None
+ */
+void BandpassBatch_Reset(BandpassBatch* batch);
+
+/**
+ * @brief  Filter n time steps of 8 interleaved channels.
+ *
+ * @param[inout]  batch  Pointer to the BandpassBatch structure.
+ * @param[in]     in     n * 8 samples, in[t * 8 + lane].
+ * @param[out]    out    n * 8 filtered samples, same layout, may alias in.
+ * @param[in]     n      Number of time steps.
+ *
+ * @attention  State carries across calls.
+ *
+ * @return
+ *  - None
+ */
+void BandpassBatch_Run(BandpassBatch* batch, const int32_t* in, int32_t* out, size_t n);
+
+/**
+ * @brief  Filter any number of planar channels, 8 at a time.
+ *
+ * @param[inout]  batch     Pointer to the BandpassBatch structure.
+ * @param[in]     in        in[c] points to n samples of channel c.
+ * @param[out]    out       out[c] receives n filtered samples of channel c.
+ * @param[in]     channels  Number of channels.
+ * @param[in]     n         Samples per channel.
+ *
+ * @attention  Every channel starts from a cleared state; batch is reset
+ *             for each group of 8 channels and left holding the last one.
+ *
+ * @return
+ *  - None
+ */
+void BandpassBatch_FilterChannels(BandpassBatch* batch, const int32_t* const* in, int32_t* const* out,
+                                  size_t channels, size_t n);
+
+#endif /* BANDPASS_BATCH_H_ */
+/* End of file -------------------------------------------------------- */
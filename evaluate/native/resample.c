@@ -0,0 +1,195 @@
+/**
+ * @file       resample.c
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Filter design and streaming kernel of the polyphase resampler.
+ *
+ * @note       Output k needs inputs up to j = floor((k * down + half) / up),
+ *             where half is the filter centre at the upsampled rate, and
+ *             uses phase (k * down + half) mod up. The kernel keeps that
+ *             phase and the number of inputs still missing, so each input
+ *             costs one history write and each output one dot product of
+ *             taps coefficients; nothing depends on the stream length.
+ * @example    resample.h
+ */
+
+/* Includes ----------------------------------------------------------- */
+#include "resample.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private function prototypes ---------------------------------------- */
+/**
+ * @brief  Modified Bessel function of the first kind, order 0.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - I0(x)
+ */
+static double Resampler_BesselI0(double x);
+
+/**
+ * @brief  Push one sample into the history and emit the outputs it completes.
+ *
+ * @param[in]  limit  Stop once rs->produced reaches this.
+ *
+ * @attention  Internal function, not for direct use.
+ *
+ * @return
+ *  - Number of outputs written
+ */
+static inline size_t Resampler_Push(Resampler* rs, float x, int32_t* out, uint64_t limit);
+
+/* Function definitions ----------------------------------------------- */
+uint32_t Resampler_Init(Resampler* rs, uint32_t up, uint32_t down)
+{
+    if (rs == NULL || up == 0 || down == 0) return RESAMPLER_ERROR;
+
+    uint32_t a = up;
+    uint32_t b = down;
+    while (b != 0) {
+        uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    up /= a;
+    down /= a;
+
+    const uint32_t max_rate = (up > down) ? up : down;
+    const uint32_t half = RESAMPLER_ZERO_CROSSINGS * max_rate;
+    const uint32_t length = 2 * half + 1;
+    const double cutoff = 1.0 / max_rate;
+
+    rs->up = up;
+    rs->down = down;
+    rs->taps = (length + up - 1) / up;
+    rs->latency = half / up;
+    rs->table = calloc((size_t)up * rs->taps, sizeof(float));
+    rs->history = calloc(2 * (size_t)rs->taps, sizeof(float));
+    double* h = malloc(length * sizeof(double));
+    if (rs->table == NULL || rs->history == NULL || h == NULL) {
+        free(h);
+        Resampler_Free(rs);
+        return RESAMPLER_ERROR;
+    }
+
+    // Windowed sinc, unit DC gain, then the interpolation gain up
+    double sum = 0;
+    for (uint32_t n = 0; n < length; n++) {
+        double m = (double)n - half;
+        double t = 2.0 * n / (length - 1) - 1.0;
+        double sinc = (m == 0) ? 1.0 : sin(M_PI * cutoff * m) / (M_PI * cutoff * m);
+        h[n] = sinc * Resampler_BesselI0(RESAMPLER_KAISER_BETA * sqrt(1.0 - t * t)) /
+               Resampler_BesselI0(RESAMPLER_KAISER_BETA);
+        sum += h[n];
+    }
+
+    // Phase p pairs h[p + i * up] with the input i samples before the newest
+    for (uint32_t p = 0; p < up; p++) {
+        for (uint32_t t = 0; t < rs->taps; t++) {
+            uint32_t n = p + (rs->taps - 1 - t) * up;
+            rs->table[p * rs->taps + t] = (n < length) ? (float)(h[n] * up / sum) : 0.0f;
+        }
+    }
+    free(h);
+
+    Resampler_Reset(rs);
+    return RESAMPLER_SUCCESS;
+}
+
+void Resampler_Free(Resampler* rs)
+{
+    if (rs == NULL) return;
+    free(rs->table);
+    free(rs->history);
+    rs->table = NULL;
+    rs->history = NULL;
+}
+
+void Resampler_Reset(Resampler* rs)
+{
+    const uint32_t half = RESAMPLER_ZERO_CROSSINGS * ((rs->up > rs->down) ? rs->up : rs->down);
+    memset(rs->history, 0, 2 * (size_t)rs->taps * sizeof(float));
+    rs->pos = 0;
+    rs->phase = half % rs->up;
+    rs->wait = half / rs->up + 1;
+    rs->consumed = 0;
+    rs->produced = 0;
+}
+
+size_t Resampler_MaxOutput(const Resampler* rs, size_t n)
+{
+    return (n * rs->up) / rs->down + 1;
+}
+
+size_t Resampler_Process(Resampler* rs, const int32_t* in, int32_t* out, size_t n)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        count += Resampler_Push(rs, (float)in[i], out + count, UINT64_MAX);
+    }
+    rs->consumed += n;
+    return count;
+}
+
+size_t Resampler_Flush(Resampler* rs, int32_t* out)
+{
+    // Stream total as resample_poly: ceil(consumed * up / down)
+    const uint64_t total = (rs->consumed * rs->up + rs->down - 1) / rs->down;
+    size_t count = 0;
+    while (rs->produced < total) {
+        count += Resampler_Push(rs, 0.0f, out + count, total);
+    }
+    return count;
+}
+
+/* Private definitions ----------------------------------------------- */
+static double Resampler_BesselI0(double x)
+{
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k < 50 && term > 1e-12 * sum; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+static inline size_t Resampler_Push(Resampler* rs, float x, int32_t* out, uint64_t limit)
+{
+    const uint32_t taps = rs->taps;
+    size_t count = 0;
+
+    rs->history[rs->pos] = x;
+    rs->history[rs->pos + taps] = x;
+    if (++rs->pos == taps) rs->pos = 0;
+
+    if (--rs->wait != 0) return 0;
+
+    // history[pos .. pos + taps - 1] now runs oldest to newest
+    const float* window = rs->history + rs->pos;
+    do {
+        if (rs->produced >= limit) break;
+        const float* coeffs = rs->table + (size_t)rs->phase * taps;
+        float acc = 0.0f;
+        for (uint32_t t = 0; t < taps; t++) {
+            acc += coeffs[t] * window[t];
+        }
+        out[count++] = (int32_t)lrintf(acc);
+        rs->produced++;
+
+        rs->phase += rs->down;
+        rs->wait = rs->phase / rs->up;
+        rs->phase %= rs->up;
+    } while (rs->wait == 0);
+
+    return count;
+}
+
+/* End of file -------------------------------------------------------- */
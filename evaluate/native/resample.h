@@ -0,0 +1,151 @@
+/**
+ * @file       resample.h
+ * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.
+ * @license    This project is released under the VB's License.
+ * @version    1.0.0
+ * @date       2026-10-17
+ * @author     Binh Nguyen
+ *
+ * @brief      Streaming rational polyphase resampler, used to bring reference
+ *             databases (MIT-BIH at 360 Hz) to the firmware's 200 Hz.
+ *
+ * @note       Resampling by up/down uses the same filter design as
+ *             scipy.signal.resample_poly: a Kaiser (beta 5) windowed sinc
+ *             with its cutoff at 1 / max(up, down) and 10 * max(up, down)
+ *             taps on each side at the upsampled rate, split into up phases.
+ *             Output k is the input interpolated at time k * down / up, with
+ *             zeros before the first sample, so outputs line up with the
+ *             input (annotation i maps to i * up / down). Memory is the
+ *             coefficient table plus a history of one phase length, fixed
+ *             at init whatever the record length. Each output is produced
+ *             as soon as the input it needs has arrived, rs->latency input
+ *             samples after its own time (18 samples, 50 ms, for 5/9).
+ * @example    resample_bench.c
+ *             Resampler rs;
+ *             Resampler_Init(&rs, 5, 9);                 // 360 Hz -> 200 Hz
+ *             size_t m = Resampler_Process(&rs, chunk, n, out);
+ *             for (size_t i = 0; i < m; i++)
+ *                 y = BandpassFilter_Apply(&filter, out[i]);
+ *             m = Resampler_Flush(&rs, out);              // tail at the end
+ *             Resampler_Free(&rs);
+ */
+
+/* Define to prevent recursive inclusion ------------------------------ */
+#ifndef RESAMPLE_H_
+#define RESAMPLE_H_
+
+/* Includes ----------------------------------------------------------- */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public defines ----------------------------------------------------- */
+#define RESAMPLER_ZERO_CROSSINGS (10)         /*!< Filter half length, in units of max(up, down) */
+#define RESAMPLER_KAISER_BETA    (5.0)        /*!< Window shape, as resample_poly */
+#define RESAMPLER_ERROR          (0xFFFFFFFF) /*!< Error return value */
+#define RESAMPLER_SUCCESS        (0x00000000) /*!< Success return value */
+
+/* Public enumerate/structure ----------------------------------------- */
+/**
+ * @brief Resampler state. Fields are private, use the functions below.
+ */
+typedef struct
+{
+    float* table;       /*!< up phases of taps coefficients, oldest input first */
+    float* history;     /*!< Last taps inputs, stored twice so a window is contiguous */
+    uint32_t up;        /*!< Interpolation factor, reduced by gcd */
+    uint32_t down;      /*!< Decimation factor, reduced by gcd */
+    uint32_t taps;      /*!< Coefficients per phase */
+    uint32_t latency;   /*!< Inputs between an output's time and its production */
+    uint32_t pos;       /*!< Oldest history entry */
+    uint32_t phase;     /*!< Phase of the next output */
+    uint32_t wait;      /*!< Inputs still needed before the next output */
+    uint64_t consumed;  /*!< Real inputs so far */
+    uint64_t produced;  /*!< Outputs so far */
+} Resampler;
+
+/* Public function prototypes ----------------------------------------- */
+/**
+ * @brief  Design the filter and allocate the state.
+ *
+ * @param[inout]  rs    Pointer to the Resampler structure.
+ * @param[in]     up    Interpolation factor.
+ * @param[in]     down  Decimation factor.
+ *
+ * @attention  Must be called before using the resampler. Release with
+ *             Resampler_Free.
+ *
+ * @return
+ *  - RESAMPLER_ERROR: Zero factor or out of memory
+ *  - RESAMPLER_SUCCESS: Success
+ */
+uint32_t Resampler_Init(Resampler* rs, uint32_t up, uint32_t down);
+
+/**
+ * @brief  Release the memory taken by Resampler_Init.
+ *
+ * @param[inout]  rs  Pointer to the Resampler structure.
+ *
+ * @attention  None
+ *
+ * @return
+ *  - None
+ */
+void Resampler_Free(Resampler* rs);
+
+/**
+ * @brief  Start a new stream, keep the filter.
+ *
+ * @param[inout]  rs  Pointer to the Resampler structure.
+ *
+ * @attention  None
+ *
+ * @return
+ *  - None
+ */
+void Resampler_Reset(Resampler* rs);
+
+/**
+ * @brief  Most outputs one Resampler_Process call can return for n inputs.
+ *
+ * @param[in]  rs  Pointer to the Resampler structure.
+ * @param[in]  n   Number of inputs.
+ *
+ * @attention  Resampler_Flush returns at most Resampler_MaxOutput(rs, taps).
+ *
+ * @return
+ *  - Output capacity needed
+ */
+size_t Resampler_MaxOutput(const Resampler* rs, size_t n);
+
+/**
+ * @brief  Feed n input samples, return the outputs they complete.
+ *
+ * @param[inout]  rs   Pointer to the Resampler structure.
+ * @param[in]     in   Input samples.
+ * @param[out]    out  Outputs, Resampler_MaxOutput(rs, n) entries.
+ * @param[in]     n    Number of inputs.
+ *
+ * @attention  Any chunking of the input gives the same output.
+ *
+ * @return
+ *  - Number of outputs written
+ */
+size_t Resampler_Process(Resampler* rs, const int32_t* in, int32_t* out, size_t n);
+
+/**
+ * @brief  End the stream: emit the outputs still waiting on future input.
+ *
+ * @param[inout]  rs   Pointer to the Resampler structure.
+ * @param[out]    out  Outputs, Resampler_MaxOutput(rs, rs->taps) entries.
+ *
+ * @attention  After this the stream totals ceil(inputs * up / down)
+ *             outputs, as resample_poly. Call Resampler_Reset before
+ *             feeding a new stream.
+ *
+ * @return
+ *  - Number of outputs written
+ */
+size_t Resampler_Flush(Resampler* rs, int32_t* out);
+
+#endif /* RESAMPLE_H_ */
+/* End of file -------------------------------------------------------- */
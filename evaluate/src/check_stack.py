@@ -0,0 +1,252 @@
+"""Kiem tra ngan sach stack cua pipeline firmware tu cac file .su cua GCC.
+
+Vi du:
+    python check_stack.py ../../Embedded/QRS_ECG/Debug
+    python check_stack.py build_host --ld ../../Embedded/QRS_ECG/STM32F411VETX_FLASH.ld
+
+GCC voi -fstack-usage (STM32CubeIDE bat san) ghi moi file .c thanh mot file
+.su, moi dong: 'file:dong:cot:ham<TAB>so_byte<TAB>kieu'. Voi -fcallgraph-info=su
+(bat trong cau hinh Debug) GCC ghi them file .ci chua do thi goi (dang VCG).
+Script doc tat ca .su va .ci trong thu muc, roi:
+  - moi ham trong PIPELINE_FILES phai nam trong BUDGETS (hoac DEFAULT_BUDGET)
+    va khong duoc co kieu 'dynamic' ma khong 'bounded' (stack khong gioi han);
+  - khong ham nao duoc lon hon _Min_Stack_Size trong linker script;
+  - chuoi ngat TIM2 (do thi goi tu .ci, neu khong co .ci thi ISR_CALLS, cong
+    khung ngat phan cung) phai nho hon mot nua _Min_Stack_Size, phan con lai
+    cho main. Ham goi toi ma khong co khung trong .su (va khong nam trong
+    LIBRARY_FRAMES) hoac goi gian tiep chua khai bao trong INDIRECT_CALLS la
+    loi, khong tinh la 0.
+Tra ve ma 1 khi vuot ngan sach, de buoc post-build cua Debug dung lai.
+Chi dung thu vien chuan cua Python.
+"""
+import argparse
+import os
+import re
+import sys
+
+# Cac file .c chay trong duong xu ly tin hieu
+PIPELINE_FILES = {
+    'filter.c', 'notch.c', 'biquad.c', 'baseline.c', 'qrs_detector.c',
+    'pan_tompkins.c', 'cbuffer.c', 'trace.c', 'stm32f4xx_it.c',
+}
+DEFAULT_BUDGET = 256
+
+# Ngan sach rieng (byte) cho cac ham chay moi mau hoac trong ngat. Du cho
+# khung -O0 cua ca Cortex-M4 lan x86-64 (khung host lon hon)
+BUDGETS = {
+    'TIM2_IRQHandler': 64,
+    'BandpassFilter_Apply': 64,
+    'NotchFilter_Apply': 64,
+    'BandpassFilter_Step': 32,
+    'BiquadQ15_Apply': 64,
+    'BiquadQ15_ApplyBlock': 64,
+    'cb_write': 96,
+    'cb_copy_in': 96,
+    'cb_track_write': 64,
+    'cb_space_count': 64,
+    'cb_data_count': 32,
+    'cb_round_elem': 32,
+    'cb_advance': 32,
+    'cb_offset': 32,
+    'trace_log': 96,
+    'trace_now': 32,
+    'QRSDetector_Detect': 192,
+    'QRSDetector_Push': 96,
+    'PanTompkins_Push': 96,
+}
+
+# Do thi goi trong ngat TIM2 khi khong co file .ci (build cu). Debug build
+# o -O0 nen khong ham nao bi inline, moi canh deu phai co o day
+ISR_ROOT = 'TIM2_IRQHandler'
+INDIRECT = '__indirect_call'  # Ten GCC dat cho lenh goi qua con tro ham
+ISR_CALLS = {
+    'TIM2_IRQHandler': ['BandpassFilter_Apply', 'NotchFilter_Apply', 'cb_write', 'HAL_TIM_IRQHandler'],
+    'BandpassFilter_Apply': ['BandpassFilter_Step', 'trace_log'],
+    'trace_log': ['trace_now', 'cb_write'],
+    'cb_write': ['cb_round_elem', 'cb_space_count', 'cb_copy_in', 'cb_advance', 'cb_track_write'],
+    'cb_space_count': ['cb_data_count'],
+    'cb_copy_in': ['cb_offset', 'memcpy'],
+    'cb_track_write': ['cb_data_count', INDIRECT],
+    'NotchFilter_Apply': ['BiquadQ15_Apply'],
+    'BiquadQ15_Apply': ['BiquadQ15_ApplyBlock'],
+    'HAL_TIM_IRQHandler': [
+        'HAL_TIM_IC_CaptureCallback', 'HAL_TIM_OC_DelayElapsedCallback',
+        'HAL_TIM_PWM_PulseFinishedCallback', 'HAL_TIM_PeriodElapsedCallback',
+        'HAL_TIMEx_BreakCallback', 'HAL_TIM_TriggerCallback', 'HAL_TIMEx_CommutCallback',
+    ],
+}
+# Dich cua cac lenh goi qua con tro ham, theo ham chua lenh goi
+# (cb_track_write goi callback watermark, main.c dang ky Frame_Ready)
+INDIRECT_CALLS = {
+    'cb_track_write': ['Frame_Ready'],
+}
+# Ham thu vien khong co .su (newlib viet bang assembly): khung uoc luong tren
+LIBRARY_FRAMES = {
+    'memcpy': 32,
+    'memset': 32,
+}
+EXCEPTION_FRAME = 104  # R0-R3, R12, LR, PC, xPSR va S0-S15, FPSCR (FPU bat)
+
+SU_LINE = re.compile(r'^(.*):(\d+):(\d+):(\S+)\t(\d+)\t(\S+)')
+CI_EDGE = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+LD_STACK = re.compile(r'_Min_Stack_Size\s*=\s*(0x[0-9a-fA-F]+|\d+)')
+
+
+def read_su(root):
+    """Tra ve dict ten ham -> (so byte, kieu, file)."""
+    frames = {}
+    for folder, _, files in os.walk(root):
+        for name in files:
+            if not name.endswith('.su'):
+                continue
+            with open(os.path.join(folder, name)) as f:
+                for line in f:
+                    m = SU_LINE.match(line.strip())
+                    if not m:
+                        continue
+                    source = os.path.basename(m.group(1))
+                    func = m.group(4)
+                    size = int(m.group(5))
+                    # Ham static trung ten o nhieu file: giu khung lon nhat
+                    if func not in frames or size > frames[func][0]:
+                        frames[func] = (size, m.group(6), source)
+    return frames
+
+
+def min_stack_size(ld_path):
+    """Doc _Min_Stack_Size tu linker script."""
+    with open(ld_path) as f:
+        m = LD_STACK.search(f.read())
+    if not m:
+        raise ValueError('khong tim thay _Min_Stack_Size trong %s' % ld_path)
+    return int(m.group(1), 0)
+
+
+def read_ci(root):
+    """Tra ve dict ham goi -> danh sach ham bi goi, doc tu cac file .ci."""
+    calls = {}
+    for folder, _, files in os.walk(root):
+        for name in files:
+            if not name.endswith('.ci'):
+                continue
+            with open(os.path.join(folder, name)) as f:
+                for caller, callee in CI_EDGE.findall(f.read()):
+                    # Ham static co dang 'duong_dan/file.c:ten'
+                    caller = caller.rsplit(':', 1)[-1]
+                    callee = callee.rsplit(':', 1)[-1]
+                    targets = calls.setdefault(caller, [])
+                    if callee not in targets:
+                        targets.append(callee)
+    return calls
+
+
+def reachable(calls, func, seen=None):
+    """Tap ham di toi duoc tu func (goi gian tiep da thay bang INDIRECT_CALLS)."""
+    seen = set() if seen is None else seen
+    if func in seen:
+        return seen
+    seen.add(func)
+    for callee in calls.get(func, []):
+        for target in INDIRECT_CALLS.get(func, []) if callee == INDIRECT else [callee]:
+            reachable(calls, target, seen)
+    return seen
+
+
+def chain_depth(frames, calls, func, missing, seen=()):
+    """Stack sau nhat tu func theo do thi calls, kem duong di.
+
+    Ham thieu khung duoc ghi vao missing (ten -> duong goi dau tien).
+    """
+    if func in frames:
+        size = frames[func][0]
+    elif func in LIBRARY_FRAMES:
+        size = LIBRARY_FRAMES[func]
+    else:
+        size = 0
+        missing.setdefault(func, 'khong co khung trong .su, goi tu ' + ' -> '.join(seen))
+    best, path = 0, []
+    for callee in calls.get(func, []):
+        targets = [callee]
+        if callee == INDIRECT:
+            targets = INDIRECT_CALLS.get(func, [])
+            if not targets:
+                missing.setdefault(INDIRECT + ' trong ' + func, 'chua khai bao trong INDIRECT_CALLS')
+        for target in targets:
+            if target in seen:
+                continue
+            depth, sub = chain_depth(frames, calls, target, missing, seen + (func,))
+            if depth > best:
+                best, path = depth, sub
+    return size + best, [func] + path
+
+
+def check(frames, calls, stack_size):
+    """Tra ve danh sach loi va cac dong bao cao."""
+    errors = []
+    report = []
+    for func in sorted(frames):
+        size, kind, source = frames[func]
+        if size > stack_size:
+            errors.append('%s (%s): %d byte > _Min_Stack_Size %d' % (func, source, size, stack_size))
+        if source not in PIPELINE_FILES:
+            continue
+        budget = BUDGETS.get(func, DEFAULT_BUDGET)
+        status = 'ok'
+        if 'dynamic' in kind and 'bounded' not in kind:
+            status = 'DYNAMIC'
+            errors.append('%s (%s): stack dynamic, khong gioi han duoc' % (func, source))
+        elif size > budget:
+            status = 'OVER'
+            errors.append('%s (%s): %d byte > ngan sach %d' % (func, source, size, budget))
+        report.append('  %-28s %-16s %5d / %-5d %s' % (func, source, size, budget, status))
+
+    if ISR_ROOT not in frames:
+        report.append('  ISR %s: khong co trong .su, bo qua' % ISR_ROOT)
+        return errors, report
+    missing = {}
+    depth, path = chain_depth(frames, calls, ISR_ROOT, missing)
+    for func, reason in missing.items():
+        errors.append('chuoi ngat %s: %s %s' % (ISR_ROOT, func, reason))
+    isr_budget = stack_size // 2
+    depth += EXCEPTION_FRAME
+    report.append('  ISR %s: %d byte (ngan sach %d)' % (' -> '.join(path), depth, isr_budget))
+    if depth > isr_budget:
+        errors.append('chuoi ngat %s: %d byte > %d' % (ISR_ROOT, depth, isr_budget))
+    return errors, report
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    default_ld = os.path.join(here, '..', '..', 'Embedded', 'QRS_ECG', 'STM32F411VETX_FLASH.ld')
+    parser = argparse.ArgumentParser(description='Kiem tra ngan sach stack tu file .su')
+    parser.add_argument('build_dir', help='thu muc build chua cac file .su (vd. Debug)')
+    parser.add_argument('--ld', default=default_ld, help='linker script de doc _Min_Stack_Size')
+    args = parser.parse_args()
+
+    frames = read_su(args.build_dir)
+    if not frames:
+        print('check_stack: khong co file .su trong %s (thieu -fstack-usage?)' % args.build_dir)
+        return 1
+
+    # Do thi tu .ci thi khong lech voi code; ISR_CALLS chi dung cho build cu
+    calls = read_ci(args.build_dir)
+    if calls:
+        source = 'file .ci'
+        missing = reachable(calls, ISR_ROOT) - reachable(ISR_CALLS, ISR_ROOT)
+        if missing:
+            print('check_stack: canh bao: ISR_CALLS thieu %s' % ', '.join(sorted(missing)))
+    else:
+        calls, source = ISR_CALLS, 'ISR_CALLS (khong co file .ci)'
+
+    stack_size = min_stack_size(args.ld)
+    errors, report = check(frames, calls, stack_size)
+    print('check_stack: _Min_Stack_Size = %d byte, do thi goi tu %s' % (stack_size, source))
+    for line in report:
+        print(line)
+    for e in errors:
+        print('check_stack: error: ' + e)
+    return 1 if errors else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
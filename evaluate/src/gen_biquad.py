@@ -0,0 +1,206 @@
+"""Sinh he so bo loc Butterworth bandpass dang biquad cho firmware.
+
+Vi du:
+    python gen_biquad.py --fs 200 250 360 500 --low 0.5 --high 40 --order 2 \
+        --out ../../Embedded/QRS_ECG/Core/Inc/biquad_coeffs.h
+    python gen_biquad.py --notch 50 60 --fs 200 --radius 0.96 \
+        --out ../../Embedded/QRS_ECG/Core/Inc/notch_coeffs.h
+
+Moi tan so lay mau cho ra mot bo he so Q31 (int32) va Q15 (int16) dung voi
+BiquadQ31_* / BiquadQ15_* trong biquad.h. Thu tu he so moi tang:
+{b0, b1, b2, -a1, -a2}, giong CMSIS-DSP. Che do --notch sinh bo loc chan
+dai hai cuc (zero tren vong tron don vi, cuc ban kinh --radius) cho nhieu
+dien luoi. Chi dung thu vien chuan cua Python.
+"""
+import argparse
+import cmath
+import math
+
+
+def butter_bandpass_sections(fs, low, high, order):
+    """Tinh cac tang biquad (b, a) dang so thuc cho Butterworth bandpass."""
+    # Bien doi song tuyen tinh voi tien meo tan so
+    fs2 = 2.0 * fs
+    w1 = fs2 * math.tan(math.pi * low / fs)
+    w2 = fs2 * math.tan(math.pi * high / fs)
+    w0 = math.sqrt(w1 * w2)
+    bw = w2 - w1
+
+    # Cuc cua bo loc thong thap mau, chuyen sang thong dai
+    poles = []
+    for k in range(order):
+        p = cmath.exp(1j * math.pi * (2 * k + order + 1) / (2 * order))
+        half = p * bw / 2.0
+        root = cmath.sqrt(half * half - w0 * w0)
+        for s in (half + root, half - root):
+            poles.append((fs2 + s) / (fs2 - s))
+
+    # Moi tang lay mot cap cuc lien hop, mot zero tai z=1 va mot zero tai z=-1
+    upper = sorted([p for p in poles if p.imag > 0], key=abs)
+    sections = []
+    for p in upper:
+        a = [1.0, -2.0 * p.real, abs(p) ** 2]
+        b = [1.0, 0.0, -1.0]
+        # Chuan hoa do loi cua tang ve 1 tai tan so cua cuc
+        g = abs(freq_response([(b, a)], cmath.phase(p)))
+        sections.append(([x / g for x in b], a))
+
+    # Chinh do loi tong ve 1 tai tan so trung tam
+    center = 2.0 * math.atan(w0 / fs2)
+    g = abs(freq_response(sections, center))
+    b, a = sections[-1]
+    sections[-1] = ([x / g for x in b], a)
+    return sections
+
+
+def notch_section(fs, f0, radius):
+    """Mot tang notch tai f0, do loi DC bang 1."""
+    c = math.cos(2.0 * math.pi * f0 / fs)
+    b = [1.0, -2.0 * c, 1.0]
+    a = [1.0, -2.0 * radius * c, radius * radius]
+    g = abs(freq_response([(b, a)], 0.0))
+    return [([x / g for x in b], a)]
+
+
+def freq_response(sections, w):
+    """Dap ung tan so cua chuoi biquad tai tan so goc w (rad/mau)."""
+    z1 = cmath.exp(-1j * w)
+    z2 = z1 * z1
+    h = 1.0
+    for b, a in sections:
+        h *= (b[0] + b[1] * z1 + b[2] * z2) / (a[0] + a[1] * z1 + a[2] * z2)
+    return h
+
+
+def quantize(sections, bits):
+    """Luong tu hoa he so, tra ve (danh sach so nguyen, post_shift)."""
+    coeffs = []
+    for b, a in sections:
+        coeffs += [b[0], b[1], b[2], -a[1], -a[2]]
+    shift = 0
+    while max(abs(c) for c in coeffs) >= (1 << shift):
+        shift += 1
+    scale = 1 << (bits - 1 - shift)
+    limit = (1 << (bits - 1)) - 1
+    return [max(-limit - 1, min(limit, int(round(c * scale)))) for c in coeffs], shift
+
+
+def format_array(ctype, name, values, per_line=5):
+    """In mang C, moi dong mot tang."""
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+    return 'static const %s %s[] = {\n%s\n};\n' % (ctype, name, '\n'.join(lines))
+
+
+def header(filename, brief, guard):
+    """Phan dau file header chung."""
+    return [
+        '/**',
+        ' * @file       %s' % filename,
+        ' * @copyright  Copyright (C) 2025 HCMUS. All rights reserved.',
+        " * @license    This project is released under the VB's License.",
+        ' * @version    1.0.0',
+        ' * @date       2026-10-17',
+        ' * @author     Binh Nguyen',
+        ' *',
+        ' * @brief      %s' % brief,
+        ' *',
+        ' * @note       Generated by evaluate/src/gen_biquad.py, do not edit.',
+        ' *             Stage layout {b0, b1, b2, -a1, -a2}.',
+        ' * @example    biquad.h',
+        ' */',
+        '',
+        '/* Define to prevent recursive inclusion ------------------------------ */',
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '/* Includes ----------------------------------------------------------- */',
+        '#include <stdint.h>',
+        '',
+    ]
+
+
+def generate(fs_list, low, high, order):
+    """Tao noi dung file header."""
+    out = header('biquad_coeffs.h', 'Butterworth bandpass %g-%g Hz, order %d, as biquad cascades.'
+                 % (low, high, order), 'INC_BIQUAD_COEFFS_H_')
+    out.append('/* Public defines ----------------------------------------------------- */')
+    out.append('#define BIQUAD_BP_LOW_HZ   (%r)' % float(low))
+    out.append('#define BIQUAD_BP_HIGH_HZ  (%r)' % float(high))
+    out.append('#define BIQUAD_BP_STAGES   (%d)' % order)
+    out.append('')
+    out.append('/* Public variables --------------------------------------------------- */')
+    for fs in fs_list:
+        sections = butter_bandpass_sections(fs, low, high, order)
+        q31, shift31 = quantize(sections, 32)
+        q15, shift15 = quantize(sections, 16)
+        tag = '%dHZ' % fs
+        out.append('#define BIQUAD_BP_%s_Q31_SHIFT (%d)' % (tag, shift31))
+        out.append('#define BIQUAD_BP_%s_Q15_SHIFT (%d)' % (tag, shift15))
+        out.append(format_array('int32_t', 'biquad_bp_%dhz_q31' % fs, q31))
+        out.append(format_array('int16_t', 'biquad_bp_%dhz_q15' % fs, q15))
+    out.append('#endif /* INC_BIQUAD_COEFFS_H_ */')
+    out.append('/* End of file -------------------------------------------------------- */')
+    return '\n'.join(out) + '\n'
+
+
+def generate_notch(fs_list, freqs, radius):
+    """Tao noi dung file header cho cac bo notch, chi Q15 (mot tang)."""
+    out = header('notch_coeffs.h', 'Mains notch %s Hz, pole radius %r, as single biquads.'
+                 % ('/'.join('%g' % f for f in freqs), radius), 'INC_NOTCH_COEFFS_H_')
+    out.append('/* Public defines ----------------------------------------------------- */')
+    out.append('#define BIQUAD_NOTCH_RADIUS (%r)' % float(radius))
+    out.append('#define BIQUAD_NOTCH_STAGES (1)')
+    out.append('')
+    out.append('/* Public variables --------------------------------------------------- */')
+    for fs in fs_list:
+        for f0 in freqs:
+            sections = notch_section(fs, f0, radius)
+            q15, shift15 = quantize(sections, 16)
+            tag = 'NOTCH%d_FS%d' % (f0, fs)
+            out.append('#define BIQUAD_%s_Q15_SHIFT (%d)' % (tag, shift15))
+            out.append(format_array('int16_t', 'biquad_notch%d_fs%d_q15' % (f0, fs), q15))
+    out.append('#endif /* INC_NOTCH_COEFFS_H_ */')
+    out.append('/* End of file -------------------------------------------------------- */')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Sinh he so biquad Butterworth bandpass')
+    parser.add_argument('--fs', type=int, nargs='+', default=[200, 250, 360, 500])
+    parser.add_argument('--low', type=float, default=0.5)
+    parser.add_argument('--high', type=float, default=40.0)
+    parser.add_argument('--order', type=int, default=2)
+    parser.add_argument('--notch', type=int, nargs='+', help='tan so dien luoi (Hz), sinh notch thay cho bandpass')
+    parser.add_argument('--radius', type=float, default=0.96, help='ban kinh cuc cua notch')
+    parser.add_argument('--out', default='../../Embedded/QRS_ECG/Core/Inc/biquad_coeffs.h')
+    args = parser.parse_args()
+
+    if args.notch:
+        with open(args.out, 'w') as f:
+            f.write(generate_notch(args.fs, args.notch, args.radius))
+        for fs in args.fs:
+            print('fs=%d Hz:' % fs)
+            for f0 in args.notch:
+                sections = notch_section(fs, f0, args.radius)
+                for hz in (0.0, 10.0, f0 - 5, f0 - 1, f0, f0 + 1):
+                    if hz < fs / 2:
+                        h = abs(freq_response(sections, 2 * math.pi * hz / fs))
+                        print('  notch %d, %6.2f Hz: %7.2f dB' % (f0, hz, 20 * math.log10(max(h, 1e-12))))
+        return
+
+    with open(args.out, 'w') as f:
+        f.write(generate(args.fs, args.low, args.high, args.order))
+
+    for fs in args.fs:
+        sections = butter_bandpass_sections(fs, args.low, args.high, args.order)
+        print('fs=%d Hz:' % fs)
+        for hz in (args.low / 4, args.low, args.high, 50.0, 60.0):
+            if hz < fs / 2:
+                h = abs(freq_response(sections, 2 * math.pi * hz / fs))
+                print('  %6.2f Hz: %7.2f dB' % (hz, 20 * math.log10(max(h, 1e-12))))
+
+
+if __name__ == '__main__':
+    main()
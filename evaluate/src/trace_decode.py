@@ -0,0 +1,106 @@
+"""Giai ma trace nhi phan cua firmware (trace.h) thanh cac dong DEBUG: van ban.
+
+Vi du:
+    python trace_decode.py capture.bin
+    python trace_decode.py capture.bin --timestamps --clock 100000000
+
+File dau vao la toan bo byte doc tu UART. Goi trace gom TRACE_SYNC (0xC5),
+16 byte ban ghi little-endian {timestamp u32, event u16, arg0 u16, arg1 i32,
+arg2 i32} va 1 byte checksum. Frame du lieu 0xAA..0xBB va cac dong DEBUG:
+van ban duoc bo qua hoac giu nguyen. Chi dung thu vien chuan cua Python.
+"""
+import argparse
+import struct
+import sys
+
+TRACE_SYNC = 0xC5
+RECORD = struct.Struct('<IHHii')
+PACKET_SIZE = 1 + RECORD.size + 1
+FRAME_SIZE = 259
+
+# Giu dong bo voi trace_event_t trong trace.h
+EVENTS = {
+    0: ('TRACE_LOST', lambda a0, a1, a2: '%d' % a1),
+    1: ('FILTER', lambda a0, a1, a2: '%d' % a1),
+    2: ('MEAN', lambda a0, a1, a2: '%d' % a1),
+    3: ('SAMPLE', lambda a0, a1, a2: '%u:%d' % (a0, a1)),
+    4: ('POTENTIAL_PEAK', lambda a0, a1, a2: '%u:%d' % (a0, a1)),
+    5: ('MIN_DISTANCE', lambda a0, a1, a2: '%u' % a0),
+    6: ('PEAK', lambda a0, a1, a2: '%u:%d' % (a0, a1)),
+    7: ('TOTAL', lambda a0, a1, a2: '%u' % a0),
+}
+EV_PEAK = 6
+EV_TOTAL = 7
+
+
+def scan(data):
+    """Tach luong byte thanh ('record', tuple) va ('text', str)."""
+    i = 0
+    n = len(data)
+    while i < n:
+        b = data[i]
+        if b == TRACE_SYNC and i + PACKET_SIZE <= n:
+            body = data[i + 1:i + 1 + RECORD.size]
+            if sum(body) & 0xFF == data[i + PACKET_SIZE - 1]:
+                yield 'record', RECORD.unpack(body)
+                i += PACKET_SIZE
+                continue
+        if b == 0xAA and i + FRAME_SIZE <= n and data[i + FRAME_SIZE - 1] == 0xBB \
+                and sum(data[i + 1:i + FRAME_SIZE - 2]) & 0xFF == data[i + FRAME_SIZE - 2]:
+            i += FRAME_SIZE
+            continue
+        if data.startswith(b'DEBUG:', i):
+            end = data.find(b'\n', i)
+            if end != -1:
+                yield 'text', data[i:end].decode('ascii', errors='replace')
+                i = end + 1
+                continue
+        i += 1
+
+
+def decode(data, timestamps=False, clock=None):
+    """Tra ve danh sach dong van ban, giong dinh dang sprintf cu."""
+    lines = []
+    peaks = []
+    for kind, item in scan(data):
+        if kind == 'text':
+            lines.append(item)
+            continue
+
+        ts, event, a0, a1, a2 = item
+        name, fmt = EVENTS.get(event, ('EVENT_%d' % event, lambda x, y, z: '%u:%d:%d' % (x, y, z)))
+        line = 'DEBUG:%s:%s' % (name, fmt(a0, a1, a2))
+        if timestamps:
+            stamp = '%.6f' % (ts / clock) if clock else '%u' % ts
+            line = '[%s] %s' % (stamp, line)
+        lines.append(line)
+
+        # Firmware khong con gui QRS_INDICES, dung lai tu cac ban ghi PEAK
+        if event == EV_PEAK:
+            peaks.append(a0)
+        elif event == EV_TOTAL:
+            if peaks:
+                lines.append('DEBUG:QRS_INDICES:' + ','.join(str(p) for p in sorted(peaks)))
+            peaks = []
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Giai ma trace nhi phan tu UART')
+    parser.add_argument('capture', help='file byte doc tu UART, "-" la stdin')
+    parser.add_argument('--timestamps', action='store_true', help='in timestamp truoc moi dong')
+    parser.add_argument('--clock', type=float, default=None, help='Hz cua DWT, doi timestamp sang giay')
+    args = parser.parse_args()
+
+    if args.capture == '-':
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+
+    for line in decode(data, args.timestamps, args.clock):
+        print(line)
+
+
+if __name__ == '__main__':
+    main()